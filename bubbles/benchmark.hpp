@@ -0,0 +1,411 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Caspar Kielwein
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef BUBBLES_BENCHMARK_HPP_
+#define BUBBLES_BENCHMARK_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <ios>
+#include <limits>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/*
+ * A minimal microbenchmark harness without dependencies.
+ *
+ * Benchmarks are registered at namespace scope with BENCHMARK.
+ * The body is either called once per iteration,
+ * or takes the number of iterations and runs the loop itself:
+ * ~~~{.cpp}
+ * BENCHMARK("next_power_of_two", [] {
+ *     do_not_optimize(next_power_of_two(value));
+ * });
+ * BENCHMARK("scan 1e6 rows", [](std::size_t iterations) {
+ *     for (std::size_t i = 0; i < iterations; ++i)
+ *         do_not_optimize(scan(rows));
+ * });
+ * ~~~
+ *
+ * Each benchmark is warmed up, until a single batch of iterations runs for at least min_time.
+ * This batch is then timed repeatedly. The median, the median absolute deviation (MAD)
+ * and the maximum of the time per iteration are reported.
+ * Each sample is the mean time per iteration of a whole batch, so these describe the spread
+ * between batches, not the latency of single calls.
+ * run_registered_benchmarks handles the command line and reports as a table, CSV or JSON.
+ *
+ * \author ckielwein
+ */
+
+#ifdef __GNUC__
+#define BENCHMARK_NOINLINE __attribute__((noinline))
+#elif defined(_MSC_VER)
+#define BENCHMARK_NOINLINE __declspec(noinline)
+#else
+#define BENCHMARK_NOINLINE
+#endif
+
+/**
+ * \brief prevents the compiler from optimizing away the computation of \p value
+ *
+ * The value is treated as if it was read by an unknown function.
+ */
+template<class T>
+inline void do_not_optimize(const T& value) {
+#ifdef __GNUC__
+	asm volatile("" : : "r,m"(value) : "memory");
+#else
+	static volatile const void* sink;
+	sink = &value;
+#endif
+}
+
+/// prevents the compiler from optimizing away writes to memory, or reordering memory accesses around it
+inline void clobber_memory() {
+#ifdef __GNUC__
+	asm volatile("" : : : "memory");
+#else
+	std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+}
+
+struct benchmark_options {
+	/// number of timed batches
+	int repetitions = 15;
+	/// minimum duration of a single batch, the number of iterations is chosen accordingly
+	std::chrono::nanoseconds min_time = std::chrono::milliseconds { 10 };
+};
+
+/// summary of all repetitions of a benchmark, all times are in nanoseconds per iteration
+struct benchmark_result {
+	std::string name;
+	std::size_t iterations;
+	int repetitions;
+	double median;
+	double mad;
+	/// slowest batch
+	double max;
+	double min;
+	double mean;
+};
+
+namespace detail {
+
+using benchmark_body = std::function<void(std::size_t)>;
+
+struct registered_benchmark {
+	std::string name;
+	benchmark_body body;
+};
+
+inline std::vector<registered_benchmark>& benchmark_registry() {
+	static std::vector<registered_benchmark> registry;
+	return registry;
+}
+
+template<class F>
+auto make_benchmark_body(F f, int) -> decltype(f(std::size_t { }), benchmark_body { }) {
+	return benchmark_body { std::move(f) };
+}
+
+template<class F>
+benchmark_body make_benchmark_body(F f, long) {
+	return [f](std::size_t iterations) mutable {
+		for (std::size_t i = 0; i < iterations; ++i)
+			f();
+	};
+}
+
+/// parses a non-negative decimal number, false if \p text is no number or does not fit an int
+inline bool parse_count(const std::string& text, int& result) {
+	if (text.empty())
+		return false;
+	long long value = 0;
+	for (char c : text) {
+		if (c < '0' || c > '9')
+			return false;
+		value = value * 10 + (c - '0');
+		if (value > std::numeric_limits<int>::max())
+			return false;
+	}
+	result = static_cast<int>(value);
+	return true;
+}
+
+inline double time_batch(const benchmark_body& body, std::size_t iterations) {
+	const auto start = std::chrono::steady_clock::now();
+	body(iterations);
+	const auto stop = std::chrono::steady_clock::now();
+	return std::chrono::duration<double, std::nano>(stop - start).count();
+}
+
+inline double median(std::vector<double> v) {
+	std::sort(v.begin(), v.end());
+	const auto n = v.size();
+	return n % 2 ? v[n / 2] : (v[n / 2 - 1] + v[n / 2]) / 2;
+}
+
+inline void escape_json(std::ostream& out, const std::string& s) {
+	for (auto c : s) {
+		if (c == '"' || c == '\\')
+			out << '\\';
+		out << c;
+	}
+}
+
+inline void escape_csv(std::ostream& out, const std::string& s) {
+	out << '"';
+	for (auto c : s) {
+		if (c == '"')
+			out << '"';
+		out << c;
+	}
+	out << '"';
+}
+
+/// sets a number format of \p out, which does not lose digits, and restores the format of the caller on destruction
+class exact_number_format {
+public:
+	explicit exact_number_format(std::ostream& out) :
+			out(out), flags(out.flags()), precision(out.precision()), width(out.width()) {
+		out.flags(std::ios_base::dec);
+		out.precision(std::numeric_limits<double>::max_digits10);
+		out.width(0);
+	}
+
+	~exact_number_format() {
+		out.flags(flags);
+		out.precision(precision);
+		out.width(width);
+	}
+
+	exact_number_format(const exact_number_format&) = delete;
+	exact_number_format& operator=(const exact_number_format&) = delete;
+
+private:
+	std::ostream& out;
+	std::ios_base::fmtflags flags;
+	std::streamsize precision;
+	std::streamsize width;
+};
+
+} // namespace detail
+
+/**
+ * \brief registers a benchmark to be run by run_registered_benchmarks
+ * \param name unique name of the benchmark
+ * \param body either callable as body() for a single iteration, or as body(iterations)
+ * \return true, to allow registration in the initializer of a static variable
+ */
+template<class F>
+bool register_benchmark(std::string name, F body) {
+	detail::benchmark_registry().push_back( { std::move(name), detail::make_benchmark_body(std::move(body), 0) });
+	return true;
+}
+
+#define BENCHMARK_CONCAT_IMPL(a, b) a##b
+#define BENCHMARK_CONCAT(a, b) BENCHMARK_CONCAT_IMPL(a, b)
+
+/// registers a benchmark at namespace scope, see register_benchmark
+#define BENCHMARK(name, ...) \
+	static const bool BENCHMARK_CONCAT(benchmark_registered_, __LINE__) = register_benchmark(name, __VA_ARGS__);
+
+namespace detail {
+
+inline benchmark_result run_benchmark_body(std::string name, const benchmark_body& body,
+		const benchmark_options& options) {
+	//warm up, and find the number of iterations which take at least min_time
+	const auto min_time = static_cast<double>(options.min_time.count());
+	//bodies which the compiler optimized away would otherwise never reach min_time
+	constexpr std::size_t max_iterations = std::size_t { 1 } << 30;
+	std::size_t iterations = 1;
+	//the first call might pay for lazy setup, like building test data on first use
+	time_batch(body, iterations);
+	for (auto t = time_batch(body, iterations); t < min_time && iterations < max_iterations;
+			t = time_batch(body, iterations)) {
+		const auto estimate = t > 0 ? iterations * 1.2 * min_time / t : iterations * 100.0;
+		iterations = std::min(max_iterations,
+				std::max(iterations * 2, static_cast<std::size_t>(std::min(estimate, iterations * 100.0))));
+	}
+
+	std::vector<double> samples;
+	const auto repetitions = std::max(options.repetitions, 1);
+	for (int r = 0; r < repetitions; ++r)
+		samples.push_back(time_batch(body, iterations) / iterations);
+
+	std::sort(samples.begin(), samples.end());
+	const auto med = median(samples);
+	std::vector<double> deviations;
+	for (auto s : samples)
+		deviations.push_back(std::abs(s - med));
+	double sum = 0;
+	for (auto s : samples)
+		sum += s;
+
+	return { std::move(name), iterations, repetitions, med, median(deviations),
+		samples.back(), samples.front(), sum / samples.size() };
+}
+
+} // namespace detail
+
+/**
+ * \brief runs a single benchmark
+ * \param name name of the benchmark, only used for the result
+ * \param body either callable as body() for a single iteration, or as body(iterations)
+ * \param options number of repetitions and minimum time per repetition
+ */
+template<class F>
+benchmark_result run_benchmark(std::string name, F body, const benchmark_options& options = { }) {
+	return detail::run_benchmark_body(std::move(name), detail::make_benchmark_body(std::move(body), 0), options);
+}
+
+/// writes results as an aligned table for humans
+inline void print_results_table(std::ostream& out, const std::vector<benchmark_result>& results) {
+	std::size_t width = 9;
+	for (const auto& r : results)
+		width = std::max(width, r.name.size());
+
+	auto column = [&out](const std::string& s, std::size_t w) {
+		out << s << std::string(w > s.size() ? w - s.size() : 0, ' ');
+	};
+	auto time = [](double ns) {
+		auto s = std::to_string(ns);
+		return s.substr(0, s.find('.') + 3) + " ns";
+	};
+
+	column("benchmark", width + 2);
+	column("median", 16);
+	column("mad", 16);
+	column("max", 16);
+	out << "iterations\n";
+	for (const auto& r : results) {
+		column(r.name, width + 2);
+		column(time(r.median), 16);
+		column(time(r.mad), 16);
+		column(time(r.max), 16);
+		out << r.iterations << '\n';
+	}
+}
+
+/// writes results as CSV with a header line, times are in nanoseconds per iteration
+inline void print_results_csv(std::ostream& out, const std::vector<benchmark_result>& results) {
+	const detail::exact_number_format format { out };
+	out << "name,iterations,repetitions,median_ns,mad_ns,max_ns,min_ns,mean_ns\n";
+	for (const auto& r : results) {
+		detail::escape_csv(out, r.name);
+		out << ',' << r.iterations << ',' << r.repetitions << ',' << r.median << ',' << r.mad << ','
+				<< r.max << ',' << r.min << ',' << r.mean << '\n';
+	}
+}
+
+/// writes results as a JSON array of objects, times are in nanoseconds per iteration
+inline void print_results_json(std::ostream& out, const std::vector<benchmark_result>& results) {
+	const detail::exact_number_format format { out };
+	out << "[\n";
+	for (std::size_t i = 0; i < results.size(); ++i) {
+		const auto& r = results[i];
+		out << "  {\"name\": \"";
+		detail::escape_json(out, r.name);
+		out << "\", \"iterations\": " << r.iterations << ", \"repetitions\": " << r.repetitions
+				<< ", \"median_ns\": " << r.median << ", \"mad_ns\": " << r.mad << ", \"max_ns\": " << r.max
+				<< ", \"min_ns\": " << r.min << ", \"mean_ns\": " << r.mean << '}'
+				<< (i + 1 < results.size() ? ",\n" : "\n");
+	}
+	out << "]\n";
+}
+
+/**
+ * \brief runs all registered benchmarks and reports the results
+ *
+ * Understands the command line arguments
+ * * --filter=text: only run benchmarks whose name contains text
+ * * --format=table|csv|json: output format, table is the default
+ * * --repetitions=n: number of timed repetitions
+ * * --min-time=ms: minimum time of each repetition in milliseconds
+ *
+ * Prints the usage for unknown or malformed arguments.
+ *
+ * \return exit code for main
+ */
+inline int run_registered_benchmarks(int argc, char* argv[], std::ostream& out) {
+	benchmark_options options;
+	std::string filter;
+	std::string format = "table";
+	auto usage = [&] {
+		out << "usage: " << argv[0]
+				<< " [--filter=text] [--format=table|csv|json] [--repetitions=n] [--min-time=ms]\n";
+		return 1;
+	};
+
+	for (int i = 1; i < argc; ++i) {
+		const std::string arg = argv[i];
+		auto value = [&arg](const std::string& option) {
+			return arg.compare(0, option.size(), option) == 0 ? arg.substr(option.size()) : std::string { };
+		};
+		int number = 0;
+		if (!value("--filter=").empty())
+			filter = value("--filter=");
+		else if (!value("--format=").empty())
+			format = value("--format=");
+		else if (!value("--repetitions=").empty()) {
+			if (!detail::parse_count(value("--repetitions="), number) || number == 0)
+				return usage();
+			options.repetitions = number;
+		} else if (!value("--min-time=").empty()) {
+			if (!detail::parse_count(value("--min-time="), number))
+				return usage();
+			options.min_time = std::chrono::milliseconds { number };
+		} else
+			return usage();
+	}
+	if (format != "table" && format != "csv" && format != "json")
+		return usage();
+
+	std::vector<benchmark_result> results;
+	for (const auto& b : detail::benchmark_registry()) {
+		if (b.name.find(filter) != std::string::npos)
+			results.push_back(detail::run_benchmark_body(b.name, b.body, options));
+	}
+
+	if (format == "csv")
+		print_results_csv(out, results);
+	else if (format == "json")
+		print_results_json(out, results);
+	else
+		print_results_table(out, results);
+	return 0;
+}
+
+#endif /* BUBBLES_BENCHMARK_HPP_ */
@@ -0,0 +1,131 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Caspar Kielwein
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "benchmark.hpp"
+
+#include <cassert>
+#include <iomanip>
+#include <sstream>
+#include <string>
+
+namespace {
+
+int per_iteration_calls = 0;
+std::size_t batched_iterations = 0;
+
+BENCHMARK("per iteration", [] {
+	++per_iteration_calls;
+	do_not_optimize(per_iteration_calls);
+});
+
+BENCHMARK("batch, with \"quotes\"", [](std::size_t iterations) {
+	batched_iterations += iterations;
+	clobber_memory();
+});
+
+} // namespace
+
+int main() {
+	benchmark_options options;
+	options.repetitions = 5;
+	options.min_time = std::chrono::microseconds { 100 };
+
+	std::size_t calls = 0;
+	const auto result = run_benchmark("counting", [&calls] {
+		++calls;
+		do_not_optimize(calls);
+	}, options);
+	assert(result.name == "counting");
+	assert(result.repetitions == 5);
+	assert(result.iterations > 0);
+	assert(calls >= 5 * result.iterations);
+	assert(result.min <= result.median && result.median <= result.max);
+	assert(result.mad >= 0);
+
+	std::ostringstream csv;
+	print_results_csv(csv, { result });
+	assert(csv.str().find("name,iterations,repetitions,median_ns") == 0);
+	assert(csv.str().find("\"counting\",") != std::string::npos);
+
+	//the format of the caller's stream does not change the reported numbers, and is kept
+	benchmark_result exact = result;
+	exact.median = 1234.5678;
+	exact.iterations = 255;
+	std::ostringstream narrow_csv;
+	narrow_csv << std::setprecision(2) << std::fixed << std::hex;
+	print_results_csv(narrow_csv, { exact });
+	assert(narrow_csv.str().find(",255,5,1234.5678,") != std::string::npos);
+	assert(narrow_csv.precision() == 2);
+	assert(narrow_csv.flags() & std::ios_base::fixed);
+	std::ostringstream narrow_json;
+	narrow_json << std::setprecision(2) << std::scientific;
+	print_results_json(narrow_json, { exact });
+	assert(narrow_json.str().find("\"median_ns\": 1234.5678,") != std::string::npos);
+	assert(narrow_json.flags() & std::ios_base::scientific);
+
+	std::ostringstream json;
+	print_results_json(json, { result });
+	assert(json.str().find("\"name\": \"counting\"") != std::string::npos);
+
+	char program[] = "benchmark_test";
+	char format[] = "--format=json";
+	char time[] = "--min-time=1";
+	char repetitions[] = "--repetitions=3";
+	char* argv[] = { program, format, time, repetitions };
+	std::ostringstream out;
+	assert(run_registered_benchmarks(4, argv, out) == 0);
+	assert(per_iteration_calls > 0);
+	assert(batched_iterations > 0);
+	assert(out.str().find("per iteration") != std::string::npos);
+	assert(out.str().find("with \\\"quotes\\\"") != std::string::npos);
+
+	char filter[] = "--filter=per";
+	char* filtered_argv[] = { program, filter, time };
+	std::ostringstream filtered;
+	run_registered_benchmarks(3, filtered_argv, filtered);
+	assert(filtered.str().find("quotes") == std::string::npos);
+
+	char unknown[] = "--unknown";
+	char* bad_argv[] = { program, unknown };
+	std::ostringstream usage;
+	assert(run_registered_benchmarks(2, bad_argv, usage) == 1);
+	assert(usage.str().find("usage:") != std::string::npos);
+
+	char bad_repetitions[] = "--repetitions=many";
+	char zero_repetitions[] = "--repetitions=0";
+	char bad_time[] = "--min-time=-5";
+	char bad_format[] = "--format=xml";
+	for (char* bad : { bad_repetitions, zero_repetitions, bad_time, bad_format }) {
+		char* malformed_argv[] = { program, bad };
+		std::ostringstream malformed;
+		assert(run_registered_benchmarks(2, malformed_argv, malformed) == 1);
+		assert(malformed.str().find("usage:") != std::string::npos);
+	}
+
+	return 0;
+}
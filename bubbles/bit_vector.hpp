@@ -0,0 +1,368 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Caspar Kielwein
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef BUBBLES_BIT_VECTOR_HPP_
+#define BUBBLES_BIT_VECTOR_HPP_
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace detail {
+
+inline unsigned popcount(std::uint64_t w) noexcept {
+#ifdef __GNUC__
+	return static_cast<unsigned>(__builtin_popcountll(w));
+#else
+	w = w - ((w >> 1) & 0x5555555555555555ull);
+	w = (w & 0x3333333333333333ull) + ((w >> 2) & 0x3333333333333333ull);
+	w = (w + (w >> 4)) & 0x0f0f0f0f0f0f0f0full;
+	return static_cast<unsigned>((w * 0x0101010101010101ull) >> 56);
+#endif
+}
+
+/// number of set bits in words [first, last)
+inline std::uint64_t popcount(const std::uint64_t* first, const std::uint64_t* last) noexcept {
+	//independent sums let the compiler vectorize, or at least pipeline popcnt
+	std::uint64_t sums[4] = { };
+	for (; last - first >= 4; first += 4)
+		for (int i = 0; i < 4; ++i)
+			sums[i] += popcount(first[i]);
+	for (; first != last; ++first)
+		sums[0] += popcount(*first);
+	return sums[0] + sums[1] + sums[2] + sums[3];
+}
+
+/// position of the k-th set bit in \p w, counted from 0
+inline unsigned select_in_word(std::uint64_t w, unsigned k) noexcept {
+	assert(k < popcount(w));
+	unsigned position = 0;
+	for (unsigned byte = popcount(w & 0xff); byte <= k; byte = popcount(w & 0xff)) {
+		k -= byte;
+		w >>= 8;
+		position += 8;
+	}
+	for (; k > 0; --k)
+		w &= w - 1;
+	w &= ~w + 1;
+	while (w >>= 1)
+		++position;
+	return position;
+}
+
+/**
+ * applies \p op to n words, in blocks of 4 words which the compiler vectorizes even at -O2
+ * \pre \p words and \p other do not overlap
+ */
+template<class Op>
+void apply_words(std::uint64_t* __restrict words, const std::uint64_t* __restrict other, std::size_t n, Op op) noexcept {
+	std::size_t i = 0;
+	for (; i + 4 <= n; i += 4)
+		for (std::size_t j = 0; j < 4; ++j)
+			op(words[i + j], other[i + j]);
+	for (; i < n; ++i)
+		op(words[i], other[i]);
+}
+
+} // namespace detail
+
+/**
+ * \brief dynamic bitset, which works on whole 64 bit words.
+ *
+ * Unlike std::vector<bool>, counting and bitwise operations process a word at a time
+ * in simple loops, which the compiler vectorizes.
+ * Unlike std::bitset, the size is chosen at runtime.
+ * Bits beyond size() in the last word are always zero.
+ * ~~~{.cpp}
+ * bit_vector allowed(1'000'000'000);
+ * allowed.set(42);
+ * allowed &= in_stock;
+ * auto hits = allowed.count();
+ * ~~~
+ *
+ * \author ckielwein
+ */
+class bit_vector {
+public:
+	using word_type = std::uint64_t;
+	static constexpr std::size_t word_bits = 64;
+
+	bit_vector() = default;
+
+	explicit bit_vector(std::size_t size, bool value = false) :
+			words_((size + word_bits - 1) / word_bits, value ? ~word_type { 0 } : 0), size_ { size } {
+		clear_padding();
+	}
+
+	std::size_t size() const noexcept {
+		return size_;
+	}
+
+	bool operator[](std::size_t i) const noexcept {
+		assert(i < size_);
+		return (words_[i / word_bits] >> (i % word_bits)) & 1;
+	}
+
+	bool test(std::size_t i) const noexcept {
+		return (*this)[i];
+	}
+
+	void set(std::size_t i, bool value = true) noexcept {
+		assert(i < size_);
+		const auto mask = word_type { 1 } << (i % word_bits);
+		if (value)
+			words_[i / word_bits] |= mask;
+		else
+			words_[i / word_bits] &= ~mask;
+	}
+
+	void reset(std::size_t i) noexcept {
+		set(i, false);
+	}
+
+	/// inverts all bits
+	void flip() noexcept {
+		for (auto& w : words_)
+			w = ~w;
+		clear_padding();
+	}
+
+	/// number of set bits
+	std::size_t count() const noexcept {
+		return static_cast<std::size_t>(detail::popcount(words_.data(), words_.data() + words_.size()));
+	}
+
+	/// \pre other.size() == size()
+	bit_vector& operator&=(const bit_vector& other) noexcept {
+		assert(other.size_ == size_);
+		if (&other == this)
+			return *this;
+		detail::apply_words(words_.data(), other.words_.data(), words_.size(), [](word_type& w, word_type o) {
+			w &= o;
+		});
+		return *this;
+	}
+
+	/// \pre other.size() == size()
+	bit_vector& operator|=(const bit_vector& other) noexcept {
+		assert(other.size_ == size_);
+		if (&other == this)
+			return *this;
+		detail::apply_words(words_.data(), other.words_.data(), words_.size(), [](word_type& w, word_type o) {
+			w |= o;
+		});
+		return *this;
+	}
+
+	/// \pre other.size() == size()
+	bit_vector& operator^=(const bit_vector& other) noexcept {
+		assert(other.size_ == size_);
+		if (&other == this) {
+			std::fill(words_.begin(), words_.end(), word_type { 0 });
+			return *this;
+		}
+		detail::apply_words(words_.data(), other.words_.data(), words_.size(), [](word_type& w, word_type o) {
+			w ^= o;
+		});
+		return *this;
+	}
+
+	friend bit_vector operator&(bit_vector l, const bit_vector& r) {
+		return l &= r;
+	}
+
+	friend bit_vector operator|(bit_vector l, const bit_vector& r) {
+		return l |= r;
+	}
+
+	friend bit_vector operator^(bit_vector l, const bit_vector& r) {
+		return l ^= r;
+	}
+
+	friend bool operator==(const bit_vector& l, const bit_vector& r) noexcept {
+		return l.size_ == r.size_ && l.words_ == r.words_;
+	}
+
+	friend bool operator!=(const bit_vector& l, const bit_vector& r) noexcept {
+		return !(l == r);
+	}
+
+	/// the underlying words, bit i is bit i % 64 of word i / 64
+	const word_type* words() const noexcept {
+		return words_.data();
+	}
+
+	std::size_t word_count() const noexcept {
+		return words_.size();
+	}
+
+private:
+	void clear_padding() noexcept {
+		if (size_ % word_bits)
+			words_.back() &= (word_type { 1 } << (size_ % word_bits)) - 1;
+	}
+
+	std::vector<word_type> words_;
+	std::size_t size_ = 0;
+};
+
+/**
+ * \brief index for rank and select queries on a bit_vector.
+ *
+ * rank(i) counts the set bits before position i, select(k) finds the position of the k-th set bit.
+ * Both take constant time for rank, and a short binary search for select,
+ * instead of a scan over the whole bit_vector.
+ *
+ * The index follows the interleaved layout of Zhou, Andersen and Kaminsky,
+ * "Space-Efficient, High-Performance Rank & Select Structures on Uncompressed Bit Sequences":
+ * one 64 bit entry per 2048 bits holds the count before the block and the counts of three 512 bit sub blocks.
+ * Together with samples for select, the index needs about 3.5% of the memory of the bit_vector.
+ *
+ * The index refers to the bit_vector, which must outlive it and not change.
+ * After changes, build a new index.
+ *
+ * \author ckielwein
+ */
+class rank_select_index {
+public:
+	explicit rank_select_index(const bit_vector& bits) :
+			bits_ { &bits } {
+		const auto* words = bits.words();
+		const auto word_count = bits.word_count();
+		const auto block_count = (word_count + block_words - 1) / block_words;
+		blocks.reserve(block_count + 1);
+
+		std::uint64_t total = 0;
+		for (std::size_t b = 0; b <= block_count; ++b) {
+			if (b % blocks_per_region == 0)
+				regions.push_back(total);
+			std::uint64_t entry = total - regions.back();
+			std::uint64_t block_total = 0;
+			for (std::size_t s = 0; s < 4; ++s) {
+				const auto first = std::min(word_count, b * block_words + s * sub_block_words);
+				const auto last = std::min(word_count, first + sub_block_words);
+				const auto count = detail::popcount(words + first, words + last);
+				if (s < 3)
+					entry |= count << (32 + 10 * s);
+				block_total += count;
+			}
+			//the sample of the k-th set bit is the block, which contains it
+			for (; samples.size() * sample_rate < total + block_total; )
+				samples.push_back(static_cast<std::uint32_t>(b));
+			blocks.push_back(entry);
+			total += block_total;
+		}
+		ones = total;
+	}
+
+	/// number of set bits in [0, i)
+	/// \pre i <= size of the bit_vector
+	std::size_t rank(std::size_t i) const noexcept {
+		assert(i <= bits_->size());
+		const auto b = i / block_bits;
+		const auto entry = blocks[b];
+		auto r = block_rank(b);
+		const auto sub = (i % block_bits) / sub_block_bits;
+		for (std::size_t s = 0; s < sub; ++s)
+			r += (entry >> (32 + 10 * s)) & 0x3ff;
+
+		const auto* words = bits_->words();
+		const auto first = b * block_words + sub * sub_block_words;
+		const auto word = i / bit_vector::word_bits;
+		r += detail::popcount(words + first, words + word);
+		if (i % bit_vector::word_bits)
+			r += detail::popcount(words[word] & ((std::uint64_t { 1 } << (i % bit_vector::word_bits)) - 1));
+		return static_cast<std::size_t>(r);
+	}
+
+	/// position of the k-th set bit, counted from 0
+	/// \pre k < count()
+	std::size_t select(std::size_t k) const noexcept {
+		assert(k < ones);
+		//the block is between the samples of the k-th set bit and the next one
+		auto lo = static_cast<std::size_t>(samples[k / sample_rate]);
+		auto hi = k / sample_rate + 1 < samples.size() ? samples[k / sample_rate + 1] + std::size_t { 1 } : blocks.size();
+		while (hi - lo > 1) {
+			const auto mid = lo + (hi - lo) / 2;
+			if (block_rank(mid) <= k)
+				lo = mid;
+			else
+				hi = mid;
+		}
+
+		auto remaining = k - block_rank(lo);
+		const auto entry = blocks[lo];
+		auto word = lo * block_words;
+		for (std::size_t s = 0; s < 3; ++s) {
+			const auto count = (entry >> (32 + 10 * s)) & 0x3ff;
+			if (remaining < count)
+				break;
+			remaining -= count;
+			word += sub_block_words;
+		}
+
+		const auto* words = bits_->words();
+		for (auto count = detail::popcount(words[word]); remaining >= count; count = detail::popcount(words[++word]))
+			remaining -= count;
+		return word * bit_vector::word_bits + detail::select_in_word(words[word], static_cast<unsigned>(remaining));
+	}
+
+	/// number of set bits in the bit_vector
+	std::size_t count() const noexcept {
+		return static_cast<std::size_t>(ones);
+	}
+
+	/// bytes used by the index
+	std::size_t memory_usage() const noexcept {
+		return blocks.capacity() * sizeof(std::uint64_t) + regions.capacity() * sizeof(std::uint64_t)
+				+ samples.capacity() * sizeof(std::uint32_t);
+	}
+
+private:
+	static constexpr std::size_t sub_block_words = 8;
+	static constexpr std::size_t sub_block_bits = sub_block_words * bit_vector::word_bits;
+	static constexpr std::size_t block_words = 4 * sub_block_words;
+	static constexpr std::size_t block_bits = block_words * bit_vector::word_bits;
+	/// blocks with 32 bit counts relative to a region of 2^32 bits
+	static constexpr std::size_t blocks_per_region = (std::uint64_t { 1 } << 32) / block_bits;
+	static constexpr std::uint64_t sample_rate = 8192;
+
+	std::uint64_t block_rank(std::size_t b) const noexcept {
+		return regions[b / blocks_per_region] + (blocks[b] & 0xffffffff);
+	}
+
+	const bit_vector* bits_;
+	std::vector<std::uint64_t> blocks;
+	std::vector<std::uint64_t> regions;
+	std::vector<std::uint32_t> samples;
+	std::uint64_t ones = 0;
+};
+
+#endif /* BUBBLES_BIT_VECTOR_HPP_ */
@@ -0,0 +1,154 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Caspar Kielwein
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "bit_vector.hpp"
+#include "benchmark.hpp"
+
+#include <algorithm>
+#include <bitset>
+#include <memory>
+#include <random>
+#include <vector>
+
+/*
+ * popcount, rank, select and bitwise and of bit_vector compared to std::vector<bool> and std::bitset.
+ * The bitmaps have 2^26 bits instead of the 1e9 bits of filter bitmaps,
+ * so that all three fit into memory next to each other, half of the bits are set.
+ * std::bitset has no rank and select, rank shifts a copy on the heap and counts it.
+ */
+
+namespace {
+
+constexpr std::size_t bit_count = std::size_t { 1 } << 26;
+
+struct bitmaps {
+	bitmaps() :
+			bits(bit_count), other(bit_count), bools(bit_count), other_bools(bit_count),
+			bitset(new std::bitset<bit_count>), other_bitset(new std::bitset<bit_count>) {
+		std::mt19937_64 rng { 3 };
+		for (std::size_t i = 0; i < bit_count; ++i) {
+			const auto r = rng();
+			bits.set(i, r & 1);
+			bools[i] = r & 1;
+			bitset->set(i, r & 1);
+			other.set(i, r & 2);
+			other_bools[i] = r & 2;
+			other_bitset->set(i, r & 2);
+		}
+		index.reset(new rank_select_index { bits });
+		for (int i = 0; i < 1024; ++i) {
+			positions.push_back(rng() % bit_count);
+			ranks.push_back(rng() % index->count());
+		}
+	}
+
+	bit_vector bits;
+	bit_vector other;
+	std::vector<bool> bools;
+	std::vector<bool> other_bools;
+	std::unique_ptr<std::bitset<bit_count>> bitset;
+	std::unique_ptr<std::bitset<bit_count>> other_bitset;
+	std::unique_ptr<rank_select_index> index;
+	std::vector<std::size_t> positions;
+	std::vector<std::size_t> ranks;
+};
+
+bitmaps& data() {
+	static bitmaps b;
+	return b;
+}
+
+BENCHMARK("popcount, std::vector<bool>", [] {
+	auto& d = data();
+	do_not_optimize(std::count(d.bools.begin(), d.bools.end(), true));
+});
+
+BENCHMARK("popcount, std::bitset", [] {
+	do_not_optimize(data().bitset->count());
+});
+
+BENCHMARK("popcount, bit_vector", [] {
+	do_not_optimize(data().bits.count());
+});
+
+BENCHMARK("and, std::vector<bool>", [] {
+	auto& d = data();
+	for (std::size_t i = 0; i < bit_count; ++i)
+		d.bools[i] = d.bools[i] && d.other_bools[i];
+	clobber_memory();
+});
+
+BENCHMARK("and, std::bitset", [] {
+	auto& d = data();
+	*d.bitset &= *d.other_bitset;
+	clobber_memory();
+});
+
+BENCHMARK("and, bit_vector", [] {
+	auto& d = data();
+	d.bits &= d.other;
+	clobber_memory();
+});
+
+std::size_t next_position = 0;
+
+BENCHMARK("rank, std::vector<bool>", [] {
+	auto& d = data();
+	const auto i = d.positions[next_position++ % d.positions.size()];
+	do_not_optimize(std::count(d.bools.begin(), d.bools.begin() + i, true));
+});
+
+BENCHMARK("rank, std::bitset", [] {
+	auto& d = data();
+	const auto i = d.positions[next_position++ % d.positions.size()];
+	//too large for the stack
+	auto shifted = std::make_unique<std::bitset<bit_count>>(*d.bitset);
+	*shifted <<= bit_count - i;
+	do_not_optimize(shifted->count());
+});
+
+BENCHMARK("rank, rank_select_index", [] {
+	auto& d = data();
+	do_not_optimize(d.index->rank(d.positions[next_position++ % d.positions.size()]));
+});
+
+BENCHMARK("select, std::vector<bool>", [] {
+	auto& d = data();
+	auto k = d.ranks[next_position++ % d.ranks.size()];
+	std::size_t i = 0;
+	for (; !d.bools[i] || k-- > 0; ++i) {
+	}
+	do_not_optimize(i);
+});
+
+BENCHMARK("select, rank_select_index", [] {
+	auto& d = data();
+	do_not_optimize(d.index->select(d.ranks[next_position++ % d.ranks.size()]));
+});
+
+} // namespace
@@ -0,0 +1,118 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Caspar Kielwein
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "bit_vector.hpp"
+
+#include <cassert>
+#include <random>
+#include <vector>
+
+/// compares rank and select against a naive scan
+void check_index(const bit_vector& bits) {
+	const rank_select_index index { bits };
+	assert(index.count() == bits.count());
+	std::size_t ones = 0;
+	for (std::size_t i = 0; i < bits.size(); ++i) {
+		assert(index.rank(i) == ones);
+		if (bits[i]) {
+			assert(index.select(ones) == i);
+			++ones;
+		}
+	}
+	assert(index.rank(bits.size()) == ones);
+}
+
+int main() {
+	bit_vector empty;
+	assert(empty.size() == 0);
+	assert(empty.count() == 0);
+	check_index(empty);
+
+	bit_vector b(100);
+	assert(b.count() == 0);
+	b.set(0);
+	b.set(63);
+	b.set(64);
+	b.set(99);
+	assert(b[63] && b.test(64) && !b[65]);
+	assert(b.count() == 4);
+	b.reset(63);
+	assert(!b[63]);
+	assert(b.count() == 3);
+
+	//bits beyond the size never count
+	bit_vector ones(70, true);
+	assert(ones.count() == 70);
+	ones.flip();
+	assert(ones.count() == 0);
+	ones.flip();
+	assert(ones.count() == 70);
+
+	bit_vector c(100);
+	c.set(0);
+	c.set(50);
+	assert((b & c).count() == 1);
+	assert((b | c).count() == 4);
+	assert((b ^ c).count() == 3);
+	auto d = b;
+	d &= c;
+	assert(d[0] && !d[50] && !d[99]);
+	assert(d != b);
+	d |= b;
+	assert(d == b);
+
+	//combining a bit_vector with itself
+	d &= d;
+	assert(d == b);
+	d |= d;
+	assert(d == b);
+	d ^= d;
+	assert(d.count() == 0 && d.size() == b.size());
+
+	check_index(b);
+	check_index(ones);
+	check_index(bit_vector(4096, true));
+	check_index(bit_vector(4096 + 1, true));
+
+	//random densities, crossing blocks and select samples
+	std::mt19937 rng { 1 };
+	for (double density : { 0.001, 0.1, 0.5, 0.99 }) {
+		std::bernoulli_distribution bit { density };
+		bit_vector r(100000);
+		for (std::size_t i = 0; i < r.size(); ++i)
+			r.set(i, bit(rng));
+		check_index(r);
+	}
+
+	//about 3% memory overhead
+	bit_vector large(1 << 24, true);
+	const rank_select_index index { large };
+	assert(index.memory_usage() * 100 < large.word_count() * 8 * 4);
+	assert(index.select((1 << 24) - 1) == (1 << 24) - 1);
+	assert(index.rank(1 << 23) == 1 << 23);
+}
@@ -0,0 +1,193 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Caspar Kielwein
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * C++20 module interface of all bubbles, as alternative to including their headers:
+ * ~~~{.cpp}
+ * import bubbles;
+ * ~~~
+ * The headers are included in the global module fragment, and their public names are exported
+ * with using-declarations. Thus the entities stay attached to the global module,
+ * have the same names for the linker as with textual inclusion,
+ * and their non-inline definitions come from libbubbles.a. See the Makefile to build both.
+ *
+ * Not exported:
+ * * macros, like BENCHMARK, PRINT_TRACE and FLIGHT_RECORD, include their headers if you need them
+ * * perf_event_count, which has internal linkage, use perf_sample::counts.size()
+ * * namespace detail
+ *
+ * This needs a compiler which implements using-declarations of entities of the global module fragment.
+ * GCC 12 does not, compile_bench.sh checks this before it builds the module.
+ */
+
+module;
+
+#include "bit_vector.hpp"
+#include "concurrent_cache.hpp"
+#include "demangle.hpp"
+#include "epoch_reclamation.hpp"
+#include "flight_recorder.hpp"
+#include "generator.hpp"
+#include "get_or_default.hpp"
+#include "mapped_file.hpp"
+#include "named_value.hpp"
+#include "named_value_arithmetic.hpp"
+#include "object_pool.hpp"
+#include "pair_range.hpp"
+#include "perf_counters.hpp"
+#include "power_of_two.hpp"
+#include "prettyprint.hpp"
+#include "reinterpret_copy.hpp"
+#include "safe_cstring.hpp"
+#include "scope_exit.hpp"
+#include "scope_exit_any.hpp"
+#include "sharded_counter.hpp"
+#include "small_vector.hpp"
+#include "soa_table.hpp"
+#include "string_interner.hpp"
+#include "thread_index.hpp"
+
+export module bubbles;
+
+//bit_vector
+export using ::bit_vector;
+export using ::rank_select_index;
+
+//concurrent_cache and get_or_default
+export using ::concurrent_cache;
+export using ::get_or_default;
+
+//demangle
+export using ::demangle;
+export using ::demangled_type;
+
+//epoch_reclamation
+export using ::epoch_domain;
+export using ::epoch_guard;
+
+//flight_recorder
+export using ::flight_event;
+export using ::flight_recorder;
+
+//generator
+export using ::default_frame_allocator;
+export using ::recycling_frame_allocator;
+export using ::generator;
+
+//mapped_file
+export using ::mapped_file;
+export using ::record_iterator;
+export using ::records;
+export using ::lines;
+export using ::split_records;
+
+//named_value and named_value_arithmetic, the operators also cover small_vector and perf_sample
+export using ::NamedValue;
+export using ::named_additive;
+export using ::named_scalable;
+export using ::named_unit;
+export using ::named_value_traits;
+export using ::named_cast;
+export using ::operator==;
+export using ::operator!=;
+export using ::operator<;
+export using ::operator>;
+export using ::operator<=;
+export using ::operator>=;
+export using ::operator+;
+export using ::operator-;
+export using ::operator+=;
+export using ::operator-=;
+export using ::operator*;
+export using ::operator/;
+
+//object_pool
+export using ::object_pool;
+
+//pair_range, begin and end also cover small_vector
+export using ::PairRange;
+export using ::begin;
+export using ::end;
+export using ::make_range;
+
+//perf_counters
+export using ::perf_event;
+export using ::perf_sample;
+export using ::perf_event_name;
+export using ::perf_counter_group;
+export using ::perf_region;
+
+//power_of_two
+export using ::is_power_of_two;
+export using ::next_power_of_two;
+
+//prettyprint
+export using ::print;
+export using ::print_range;
+#if __cpp_consteval
+export using ::format_string;
+export using ::print_fmt;
+#endif
+
+//reinterpret_copy
+export using ::reinterpret_copy;
+
+//safe_cstring
+export using ::safe_memcpy;
+export using ::safe_memmove;
+export using ::safe_memset;
+export using ::safe_copy_n;
+export using ::safe_copy;
+
+//scope_exit and scope_exit_any
+export using ::scope_handler;
+export using ::scope_exit;
+export using ::scope_failure;
+export using ::scope_success;
+export using ::basic_scope_exit_any;
+export using ::scope_exit_any;
+export using ::defer_stack;
+
+//sharded_counter
+export using ::basic_sharded_counter;
+export using ::sharded_counter;
+export using ::sharded_gauge;
+export using ::metrics_registry;
+
+//small_vector
+export using ::small_vector;
+
+//soa_table
+export using ::soa_table;
+
+//string_interner
+export using ::interned_string;
+export using ::string_interner;
+
+//thread_index
+export using ::thread_index;
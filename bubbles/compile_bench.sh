@@ -0,0 +1,147 @@
+#!/bin/sh
+# Copyright (c) 2026, Caspar Kielwein
+# All rights reserved. See the license in any of the bubbles for details.
+#
+# Compile time benchmark of the ways to use bubbles in a synthetic project of many translation units:
+#   textual:     every translation unit includes the headers and links libbubbles.a, built by the Makefile
+#   header_only: every translation unit includes the headers with BUBBLE_HEADER_ONLY
+#   module:      every translation unit imports the bubbles module, built once by the Makefile
+# Each mode links all translation units into one program, which also checks the one definition rule.
+# The module mode is skipped, with a message, if the compiler fails a small probe of the module features
+# bubbles.cppm uses. If the probe passes, a failure to build or link the module fails the benchmark.
+#
+# usage: compile_bench.sh [translation units, default 500]
+# The compiler is taken from CXX, default g++. Prints the compile time per translation unit of each mode.
+
+set -e
+
+units=${1:-500}
+cxx=${CXX:-g++}
+flags="-std=c++20 -O1 -pthread"
+bubbles=$(cd "$(dirname "$0")" && pwd)
+work=$(mktemp -d)
+trap 'rm -rf "$work"' EXIT
+
+now_ms() {
+	echo $(($(date +%s%N) / 1000000))
+}
+
+# writes the translation units of a mode, $1 is the mode, $2 the lines before the code
+generate() {
+	mkdir -p "$work/$1"
+	i=0
+	while [ $i -lt "$units" ]; do
+		{
+			printf '%s\n' "$2"
+			cat <<CODE
+int unit_$i(int x) {
+	bit_vector bits(next_power_of_two(x + 2));
+	bits.set(1);
+	sharded_counter calls;
+	calls.add(bits.count() + demangle("i").size());
+	if (x < 0)
+		print(x, calls.read());
+	return static_cast<int>(calls.read());
+}
+CODE
+		} > "$work/$1/unit_$i.cpp"
+		i=$((i + 1))
+	done
+	{
+		printf '%s\n' "$2"
+		i=0
+		while [ $i -lt "$units" ]; do
+			echo "int unit_$i(int);"
+			i=$((i + 1))
+		done
+		echo "int main() {"
+		echo "	int sum = 0;"
+		i=0
+		while [ $i -lt "$units" ]; do
+			echo "	sum += unit_$i(1);"
+			i=$((i + 1))
+		done
+		echo "	return sum == $((units * 4)) ? 0 : 1;"
+		echo "}"
+	} > "$work/$1/main.cpp"
+}
+
+# runs the Makefile targets $@, with the compiler and flags of the benchmark
+build() {
+	make -s -C "$bubbles" BUILD="$work/lib" CXX="$cxx" CXXFLAGS="$flags" "$@"
+}
+
+# exports a name of the global module fragment with a using-declaration, imports it, links and runs the program
+module_probe() {
+	probe="$work/probe"
+	mkdir -p "$probe"
+	printf 'inline int probe_value() { return 4; }\n' > "$probe/probe.hpp"
+	printf 'module;\n#include "probe.hpp"\nexport module probe;\nexport using ::probe_value;\n' > "$probe/probe.cppm"
+	printf 'import probe;\nint main() { return probe_value() == 4 ? 0 : 1; }\n' > "$probe/main.cpp"
+	if $cxx --version | grep -q clang; then
+		$cxx $flags --precompile -x c++-module "$probe/probe.cppm" -o "$probe/probe.pcm" &&
+		$cxx $flags -c "$probe/probe.pcm" -o "$probe/probe.o" &&
+		$cxx $flags -fmodule-file=probe="$probe/probe.pcm" -c "$probe/main.cpp" -o "$probe/main.o"
+	else
+		echo "probe $probe/probe.gcm" > "$probe/probe.map"
+		$cxx $flags -fmodules-ts -fmodule-mapper="$probe/probe.map" -c -x c++ "$probe/probe.cppm" -o "$probe/probe.o" &&
+		$cxx $flags -fmodules-ts -fmodule-mapper="$probe/probe.map" -c "$probe/main.cpp" -o "$probe/main.o"
+	fi &&
+	$cxx $flags "$probe/probe.o" "$probe/main.o" -o "$probe/program" &&
+	"$probe/program"
+}
+
+# compiles all translation units of mode $1 with the flags $2, links them with the objects $3 and runs the program
+compile() {
+	start=$(now_ms)
+	for source in "$work/$1"/unit_*.cpp; do
+		$cxx $flags $2 -I"$bubbles" -c "$source" -o "${source%.cpp}.o" || return 1
+	done
+	elapsed=$(($(now_ms) - start))
+	$cxx $flags $2 -I"$bubbles" -c "$work/$1/main.cpp" -o "$work/$1/main.o" || return 1
+	$cxx $flags "$work/$1"/*.o $3 -o "$work/$1/program" || return 1
+	"$work/$1/program" || return 1
+	echo "$1: $((elapsed / units)) ms per translation unit, $elapsed ms for $units translation units"
+}
+
+includes='#include "bit_vector.hpp"
+#include "concurrent_cache.hpp"
+#include "demangle.hpp"
+#include "epoch_reclamation.hpp"
+#include "flight_recorder.hpp"
+#include "generator.hpp"
+#include "get_or_default.hpp"
+#include "mapped_file.hpp"
+#include "named_value.hpp"
+#include "named_value_arithmetic.hpp"
+#include "object_pool.hpp"
+#include "pair_range.hpp"
+#include "perf_counters.hpp"
+#include "power_of_two.hpp"
+#include "prettyprint.hpp"
+#include "reinterpret_copy.hpp"
+#include "safe_cstring.hpp"
+#include "scope_exit.hpp"
+#include "scope_exit_any.hpp"
+#include "sharded_counter.hpp"
+#include "small_vector.hpp"
+#include "soa_table.hpp"
+#include "string_interner.hpp"
+#include "thread_index.hpp"'
+
+generate textual "$includes"
+build library
+compile textual "" "$work/lib/libbubbles.a"
+
+generate header_only "$includes"
+compile header_only "-DBUBBLE_HEADER_ONLY=1" ""
+
+if module_probe > "$work/probe.log" 2>&1; then
+	generate module "import bubbles;"
+	start=$(now_ms)
+	build module
+	echo "module: $(($(now_ms) - start)) ms to compile the module interface once"
+	compile module "$(build module-flags)" "$work/lib/bubbles_module.o $work/lib/libbubbles.a"
+else
+	echo "module: skipped, $cxx cannot import a name exported with a using-declaration from the global module fragment"
+fi
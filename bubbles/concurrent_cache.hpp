@@ -0,0 +1,269 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Caspar Kielwein
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef BUBBLES_CONCURRENT_CACHE_HPP_
+#define BUBBLES_CONCURRENT_CACHE_HPP_
+
+#include "get_or_default.hpp"
+#include "power_of_two.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * \brief bounded cache for concurrent lookups, with CLOCK eviction per shard.
+ *
+ * Keys are distributed over shards, each with its own lock, hash map and CLOCK.
+ * Hits only take a shared lock and set the reference bit of the entry,
+ * so concurrent hits do not serialize like in a list based LRU.
+ * When a shard is full, the clock hand skips and clears referenced entries
+ * and evicts the first entry which was not used since the hand last passed it.
+ *
+ * get_or_compute calls the expensive computation only once for concurrent misses of the same key,
+ * the other threads wait for its result.
+ * ~~~{.cpp}
+ * concurrent_cache<std::string, route> routes { 10000 };
+ * auto r = routes.get_or_compute(path, [](const std::string& p) { return resolve(p); });
+ * auto cached = get_or_default(routes, path, route { });
+ * ~~~
+ *
+ * \tparam Value must be copyable, lookups return copies
+ * Requires C++17.
+ *
+ * \author ckielwein
+ */
+template<class Key, class Value, class Hash = std::hash<Key>, class KeyEqual = std::equal_to<Key>>
+class concurrent_cache {
+public:
+	using key_type = Key;
+	using mapped_type = Value;
+
+	/**
+	 * \param capacity maximum number of entries, rounded up to a power of two
+	 * \param shard_count number of independently locked shards, rounded up to a power of two
+	 */
+	explicit concurrent_cache(std::size_t capacity, std::size_t shard_count = 16) :
+			capacity_ { next_power_of_two(std::max<std::size_t>(capacity, 1)) } {
+		shard_count = std::min(next_power_of_two(std::max<std::size_t>(shard_count, 1)), capacity_);
+		for (auto s = shard_count; s > 1; s /= 2)
+			++shard_bits;
+		shards.reserve(shard_count);
+		for (std::size_t i = 0; i < shard_count; ++i)
+			shards.push_back(std::make_unique<shard>(capacity_ / shard_count));
+	}
+
+	std::size_t capacity() const noexcept {
+		return capacity_;
+	}
+
+	/// number of cached entries
+	std::size_t size() const {
+		std::size_t count = 0;
+		for (const auto& s : shards) {
+			std::shared_lock<std::shared_mutex> lock { s->mutex };
+			count += s->entries.size();
+		}
+		return count;
+	}
+
+	/// inserts \p value for \p key, or replaces the cached value
+	void insert(const Key& key, Value value) {
+		auto& s = shard_of(key);
+		std::lock_guard<std::shared_mutex> lock { s.mutex };
+		s.insert(key, std::move(value));
+	}
+
+	/// removes \p key from the cache, returns whether it was cached
+	bool erase(const Key& key) {
+		auto& s = shard_of(key);
+		std::lock_guard<std::shared_mutex> lock { s.mutex };
+		return s.erase(key);
+	}
+
+	/// the cached value for \p key, or \p default_value if \p key is not cached
+	Value get_or_default(const Key& key, const Value& default_value) const {
+		auto& s = shard_of(key);
+		std::shared_lock<std::shared_mutex> lock { s.mutex };
+		const auto* v = s.find(key);
+		return v ? *v : default_value;
+	}
+
+	/**
+	 * \brief the cached value for \p key, computed with \p compute(key) and cached on a miss.
+	 *
+	 * compute runs without holding a lock. Concurrent misses of the same key wait
+	 * for the first computation instead of computing again.
+	 * If compute throws, nothing is cached and the exception propagates to all waiting callers.
+	 */
+	template<class Compute>
+	Value get_or_compute(const Key& key, Compute&& compute) {
+		auto& s = shard_of(key);
+		{
+			std::shared_lock<std::shared_mutex> lock { s.mutex };
+			if (const auto* v = s.find(key))
+				return *v;
+		}
+
+		std::promise<Value> promise;
+		{
+			std::unique_lock<std::shared_mutex> lock { s.mutex };
+			if (const auto* v = s.find(key))
+				return *v;
+			const auto pending = s.pending.find(key);
+			if (pending != s.pending.end()) {
+				auto result = pending->second;
+				lock.unlock();
+				return result.get();
+			}
+			s.pending.emplace(key, promise.get_future().share());
+		}
+
+		try {
+			Value value = std::forward<Compute>(compute)(key);
+			{
+				std::lock_guard<std::shared_mutex> lock { s.mutex };
+				s.insert(key, value);
+				s.pending.erase(key);
+			}
+			promise.set_value(value);
+			return value;
+		} catch (...) {
+			{
+				std::lock_guard<std::shared_mutex> lock { s.mutex };
+				s.pending.erase(key);
+			}
+			promise.set_exception(std::current_exception());
+			throw;
+		}
+	}
+
+private:
+	struct shard {
+		explicit shard(std::size_t cap) :
+				capacity { cap }, referenced { new std::atomic<bool>[cap] } {
+			entries.reserve(cap);
+			index.reserve(cap);
+			for (std::size_t i = 0; i < cap; ++i)
+				referenced[i].store(false, std::memory_order_relaxed);
+		}
+
+		/// \pre shared or exclusive lock
+		const Value* find(const Key& key) const {
+			const auto it = index.find(key);
+			if (it == index.end())
+				return nullptr;
+			auto& ref = referenced[it->second];
+			//only write if needed, so that hot entries do not bounce between caches
+			if (!ref.load(std::memory_order_relaxed))
+				ref.store(true, std::memory_order_relaxed);
+			return &entries[it->second].second;
+		}
+
+		/// \pre exclusive lock
+		void insert(const Key& key, Value value) {
+			const auto it = index.find(key);
+			if (it != index.end()) {
+				entries[it->second].second = std::move(value);
+				referenced[it->second].store(true, std::memory_order_relaxed);
+				return;
+			}
+			if (entries.size() < capacity) {
+				index.emplace(key, entries.size());
+				referenced[entries.size()].store(false, std::memory_order_relaxed);
+				entries.emplace_back(key, std::move(value));
+				return;
+			}
+			//second chance: skip and clear referenced entries, evict the first unreferenced one
+			while (referenced[hand].exchange(false, std::memory_order_relaxed))
+				hand = (hand + 1) % capacity;
+			index.erase(entries[hand].first);
+			entries[hand] = { key, std::move(value) };
+			index.emplace(key, hand);
+			hand = (hand + 1) % capacity;
+		}
+
+		/// \pre exclusive lock
+		bool erase(const Key& key) {
+			const auto it = index.find(key);
+			if (it == index.end())
+				return false;
+			//fill the hole with the last entry
+			const auto hole = it->second;
+			index.erase(it);
+			const auto last = entries.size() - 1;
+			if (hole != last) {
+				entries[hole] = std::move(entries[last]);
+				referenced[hole].store(referenced[last].load(std::memory_order_relaxed), std::memory_order_relaxed);
+				index[entries[hole].first] = hole;
+			}
+			entries.pop_back();
+			if (hand >= entries.size())
+				hand = 0;
+			return true;
+		}
+
+		mutable std::shared_mutex mutex;
+		const std::size_t capacity;
+		std::vector<std::pair<Key, Value>> entries;
+		std::unique_ptr<std::atomic<bool>[]> referenced;
+		std::unordered_map<Key, std::size_t, Hash, KeyEqual> index;
+		std::size_t hand = 0;
+		std::unordered_map<Key, std::shared_future<Value>, Hash, KeyEqual> pending;
+	};
+
+	shard& shard_of(const Key& key) const {
+		if (shard_bits == 0)
+			return *shards.front();
+		//fibonacci hashing, so that hashes which only differ in high bits still spread over all shards
+		const auto h = static_cast<std::uint64_t>(hash(key)) * 0x9e3779b97f4a7c15ull;
+		return *shards[static_cast<std::size_t>(h >> (64 - shard_bits))];
+	}
+
+	std::size_t capacity_;
+	Hash hash;
+	unsigned shard_bits = 0;
+	std::vector<std::unique_ptr<shard>> shards;
+};
+
+/// get_or_default for concurrent_cache, same as for maps
+template<class K, class V, class H, class E, class Key, class Value>
+V get_or_default(const concurrent_cache<K, V, H, E>& cache, const Key& key, const Value& default_value) {
+	return cache.get_or_default(key, default_value);
+}
+
+#endif /* BUBBLES_CONCURRENT_CACHE_HPP_ */
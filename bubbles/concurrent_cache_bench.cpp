@@ -0,0 +1,169 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Caspar Kielwein
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "concurrent_cache.hpp"
+#include "benchmark.hpp"
+
+#include <cmath>
+#include <iostream>
+#include <list>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/*
+ * Lookups with compute on miss in concurrent_cache compared to a mutex guarded
+ * std::unordered_map plus std::list LRU, on 1 and 4 threads.
+ * Keys follow a zipf distribution with s = 0.99 over 1M keys, the caches hold 64Ki entries.
+ * The hit ratios of both caches are reported once on stderr.
+ */
+
+namespace {
+
+constexpr std::size_t key_count = 1 << 20;
+constexpr std::size_t cache_capacity = 1 << 16;
+constexpr int thread_count = 4;
+
+/// stands in for an expensive computation
+std::uint64_t compute(std::uint64_t key) {
+	return key * key;
+}
+
+/// the usual LRU cache: every lookup moves the entry to the front of the list under one mutex
+class lru_cache {
+public:
+	template<class Compute>
+	std::uint64_t get_or_compute(std::uint64_t key, Compute c) {
+		{
+			std::lock_guard<std::mutex> lock { mutex };
+			const auto it = index.find(key);
+			if (it != index.end()) {
+				entries.splice(entries.begin(), entries, it->second);
+				return it->second->second;
+			}
+		}
+		const auto value = c(key);
+		std::lock_guard<std::mutex> lock { mutex };
+		if (index.count(key))
+			return value;
+		entries.emplace_front(key, value);
+		index.emplace(key, entries.begin());
+		if (entries.size() > cache_capacity) {
+			index.erase(entries.back().first);
+			entries.pop_back();
+		}
+		return value;
+	}
+
+private:
+	std::mutex mutex;
+	std::list<std::pair<std::uint64_t, std::uint64_t>> entries;
+	std::unordered_map<std::uint64_t, std::list<std::pair<std::uint64_t, std::uint64_t>>::iterator> index;
+};
+
+std::vector<std::uint64_t> make_keys() {
+	std::vector<double> weights;
+	for (std::size_t k = 1; k <= key_count; ++k)
+		weights.push_back(1.0 / std::pow(static_cast<double>(k), 0.99));
+	std::discrete_distribution<std::uint64_t> zipf { weights.begin(), weights.end() };
+	std::mt19937_64 rng { 11 };
+	std::vector<std::uint64_t> keys(1 << 22);
+	for (auto& k : keys)
+		k = zipf(rng);
+	return keys;
+}
+
+const std::vector<std::uint64_t>& keys() {
+	static const auto k = make_keys();
+	return k;
+}
+
+template<class Cache>
+double hit_ratio(Cache& cache) {
+	std::size_t misses = 0;
+	for (auto k : keys())
+		cache.get_or_compute(k, [&](std::uint64_t key) {
+			++misses;
+			return compute(key);
+		});
+	return 1.0 - static_cast<double>(misses) / keys().size();
+}
+
+void report_hit_ratio() {
+	static const bool reported = [] {
+		lru_cache lru;
+		concurrent_cache<std::uint64_t, std::uint64_t> cache { cache_capacity };
+		std::cerr << "zipf hit ratio, lru: " << hit_ratio(lru) << ", concurrent_cache: " << hit_ratio(cache) << '\n';
+		return true;
+	}();
+	do_not_optimize(reported);
+}
+
+/// runs iterations lookups, split over threads
+template<class Cache>
+void lookups(Cache& cache, std::size_t iterations, int threads) {
+	auto run = [&cache](std::size_t first, std::size_t count) {
+		const auto& k = keys();
+		for (std::size_t i = first; i < first + count; ++i)
+			do_not_optimize(cache.get_or_compute(k[i % k.size()], compute));
+	};
+	if (threads == 1) {
+		run(0, iterations);
+		return;
+	}
+	std::vector<std::thread> workers;
+	for (int t = 0; t < threads; ++t)
+		workers.emplace_back(run, t * (keys().size() / threads), iterations / threads);
+	for (auto& w : workers)
+		w.join();
+}
+
+lru_cache lru;
+concurrent_cache<std::uint64_t, std::uint64_t> cache { cache_capacity };
+
+BENCHMARK("lru with mutex, zipf, 1 thread", [](std::size_t iterations) {
+	report_hit_ratio();
+	lookups(lru, iterations, 1);
+});
+
+BENCHMARK("concurrent_cache, zipf, 1 thread", [](std::size_t iterations) {
+	report_hit_ratio();
+	lookups(cache, iterations, 1);
+});
+
+BENCHMARK("lru with mutex, zipf, 4 threads", [](std::size_t iterations) {
+	lookups(lru, iterations, thread_count);
+});
+
+BENCHMARK("concurrent_cache, zipf, 4 threads", [](std::size_t iterations) {
+	lookups(cache, iterations, thread_count);
+});
+
+} // namespace
@@ -0,0 +1,113 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Caspar Kielwein
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "concurrent_cache.hpp"
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+int main() {
+	concurrent_cache<int, std::string> cache { 100, 4 };
+	assert(cache.capacity() == 128);
+	assert(cache.size() == 0);
+	assert(cache.get_or_default(1, "none") == "none");
+
+	cache.insert(1, "one");
+	cache.insert(2, "two");
+	assert(cache.get_or_default(1, "none") == "one");
+	assert(get_or_default(cache, 2, std::string { "none" }) == "two");
+	cache.insert(1, "uno");
+	assert(cache.get_or_default(1, "none") == "uno");
+	assert(cache.size() == 2);
+
+	assert(cache.erase(1));
+	assert(!cache.erase(1));
+	assert(cache.get_or_default(1, "none") == "none");
+	assert(cache.get_or_default(2, "none") == "two");
+
+	//the size never exceeds the capacity
+	for (int i = 0; i < 1000; ++i)
+		cache.insert(i, std::to_string(i));
+	assert(cache.size() <= cache.capacity());
+	assert(cache.get_or_default(999, "none") == "999");
+
+	//CLOCK gives referenced entries a second chance
+	concurrent_cache<int, int> clock { 4, 1 };
+	for (int i = 0; i < 4; ++i)
+		clock.insert(i, i);
+	assert(clock.get_or_default(0, -1) == 0);
+	clock.insert(4, 4);
+	assert(clock.get_or_default(0, -1) == 0);
+	assert(clock.get_or_default(1, -1) == -1);
+
+	//compute on miss, only once
+	int computed = 0;
+	auto square = [&](int k) {
+		++computed;
+		return k * k;
+	};
+	assert(clock.get_or_compute(7, square) == 49);
+	assert(clock.get_or_compute(7, square) == 49);
+	assert(computed == 1);
+
+	//failed computations are not cached
+	bool thrown = false;
+	try {
+		clock.get_or_compute(8, [](int) -> int {
+			throw std::runtime_error("backend down");
+		});
+	} catch (const std::runtime_error&) {
+		thrown = true;
+	}
+	assert(thrown);
+	assert(clock.get_or_compute(8, square) == 64);
+
+	//concurrent misses of the same key compute once
+	concurrent_cache<int, int> shared { 1024 };
+	std::atomic<int> computations { 0 };
+	std::vector<std::thread> threads;
+	for (int t = 0; t < 8; ++t)
+		threads.emplace_back([&] {
+			for (int k = 0; k < 100; ++k) {
+				const auto v = shared.get_or_compute(k, [&](int key) {
+					++computations;
+					std::this_thread::sleep_for(std::chrono::microseconds(100));
+					return key + 1;
+				});
+				assert(v == k + 1);
+			}
+		});
+	for (auto& t : threads)
+		t.join();
+	assert(computations == 100);
+}
@@ -27,13 +27,14 @@
  */
 
 #include "demangle.hpp"
+#include "bubble_inline.hpp"
 
 #ifdef __GNUG__
 #include <cstdlib>
 #include <memory>
 #include <cxxabi.h>
 
-std::string demangle(const char* name) {
+BUBBLE_INLINE std::string demangle(const char* name) {
 	int status { -1 }; //any value to initialize status
 
 	//we use a unique_ptr's destructor to free the memory allocated by abi::__cxa_demangle
@@ -49,7 +50,7 @@ std::string demangle(const char* name) {
 
 //just return the string for other compilers then gcc
 //at least msvc already returns demangled names for typeid.name()
-std::string demangle(const char* name) {
+BUBBLE_INLINE std::string demangle(const char* name) {
 	return name;
 }
 
@@ -44,7 +44,7 @@ auto demangled_type(const T& t) {
 /// returns the demangled name of the type T
 template<class T>
 auto demangled_type() {
-	return demangle(typeid(std::declval<T>()).name());
+	return demangle(typeid(T).name());
 }
 
 
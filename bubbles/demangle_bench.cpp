@@ -0,0 +1,61 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Caspar Kielwein
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "demangle.hpp"
+#include "benchmark.hpp"
+
+#include <map>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+/*
+ * Compares demangle with just copying the mangled name, which is the lower bound.
+ */
+
+namespace {
+
+using complex_type = std::map<std::string, std::vector<std::pair<int, double>>>;
+
+BENCHMARK("copy mangled name, int", [] {
+	do_not_optimize(std::string { typeid(int).name() });
+});
+
+BENCHMARK("demangle, int", [] {
+	do_not_optimize(demangle(typeid(int).name()));
+});
+
+BENCHMARK("copy mangled name, std::map<std::string, ...>", [] {
+	do_not_optimize(std::string { typeid(complex_type).name() });
+});
+
+BENCHMARK("demangle, std::map<std::string, ...>", [] {
+	do_not_optimize(demangle(typeid(complex_type).name()));
+});
+
+} // namespace
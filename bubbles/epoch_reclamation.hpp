@@ -0,0 +1,285 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Caspar Kielwein
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef BUBBLES_EPOCH_RECLAMATION_HPP_
+#define BUBBLES_EPOCH_RECLAMATION_HPP_
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace detail {
+
+/// size of a cache line on all platforms we care about
+constexpr std::size_t epoch_cache_line = 64;
+
+/// state of a single reader, padded to avoid false sharing between readers
+struct alignas(epoch_cache_line) epoch_slot {
+	/// epoch the reader is pinned to, 0 if the reader is not in a critical section
+	std::atomic<std::uint64_t> epoch { 0 };
+	std::atomic<bool> in_use { false };
+};
+
+struct retired_object {
+	void* object;
+	void (*deleter)(void*);
+	std::uint64_t epoch;
+};
+
+} // namespace detail
+
+class epoch_domain;
+
+/**
+ * \brief RAII guard for a read side critical section of an epoch_domain
+ *
+ * While an epoch_guard is alive, no object, which was reachable
+ * when the guard was created, will be reclaimed.
+ * epoch_guard is move only, just like scope_handler.
+ */
+class epoch_guard {
+public:
+	epoch_guard(epoch_guard&& other) noexcept :
+			slot(other.slot), nesting(other.nesting) {
+		other.slot = nullptr;
+	}
+
+	epoch_guard(const epoch_guard&) = delete;
+	epoch_guard& operator=(epoch_guard&&) = delete;
+	epoch_guard& operator=(const epoch_guard&) = delete;
+
+	~epoch_guard() {
+		release();
+	}
+
+	/// leaves the critical section before the end of the scope
+	void release() noexcept {
+		if (slot && --*nesting == 0)
+			slot->epoch.store(0, std::memory_order_release);
+		slot = nullptr;
+	}
+
+private:
+	friend class epoch_domain;
+
+	epoch_guard(detail::epoch_slot* slot, int* nesting) noexcept :
+			slot(slot), nesting(nesting) {
+	}
+
+	detail::epoch_slot* slot;
+	int* nesting;
+};
+
+/**
+ * \brief epoch based memory reclamation for read mostly shared data.
+ *
+ * Readers access shared objects without reference counting.
+ * Writers replace objects and retire the old ones.
+ * A retired object is deleted, once every reader, which might still see it,
+ * has left its critical section.
+ *
+ * The read path consists of an atomic load and two atomic stores to memory
+ * only touched by the reading thread.
+ * Retiring objects takes a mutex, writers are expected to be rare.
+ *
+ * ~~~{.cpp}
+ * epoch_domain domain;
+ * std::atomic<config*> current { new config{} };
+ *
+ * //reading thread
+ * auto reader = domain.register_reader();
+ * {
+ *     auto guard = reader.pin();
+ *     const config* c = current.load(std::memory_order_acquire);
+ *     use(*c); //c stays valid until guard is destroyed
+ * }
+ *
+ * //writing thread
+ * domain.retire(current.exchange(new config{}));
+ * ~~~
+ *
+ * A reclaimed object was retired in epoch e, and the global epoch is at least e + 2.
+ * The global epoch only advances if all pinned readers have observed the current epoch.
+ * Thus no reader can still be pinned in the epoch in which the object was reachable.
+ *
+ * \author ckielwein
+ */
+class epoch_domain {
+public:
+	/**
+	 * \brief handle of a single reading thread.
+	 *
+	 * Each thread which reads needs its own reader.
+	 * The reader frees its slot in the domain on destruction.
+	 */
+	class reader {
+	public:
+		reader(reader&& other) noexcept :
+				domain(other.domain), slot(other.slot), nesting(other.nesting) {
+			other.slot = nullptr;
+		}
+
+		reader(const reader&) = delete;
+		reader& operator=(reader&&) = delete;
+		reader& operator=(const reader&) = delete;
+
+		~reader() {
+			if (slot) {
+				assert(nesting == 0 && "reader destroyed while still pinned");
+				slot->in_use.store(false, std::memory_order_release);
+			}
+		}
+
+		/**
+		 * \brief enters a read side critical section
+		 * \return guard which leaves the critical section on destruction
+		 *
+		 * Critical sections can be nested, only the outermost guard unpins the reader.
+		 */
+		epoch_guard pin() noexcept {
+			if (nesting++ == 0) {
+				slot->epoch.store(domain->global_epoch.load(std::memory_order_relaxed),
+						std::memory_order_relaxed);
+				//the pinned epoch must be visible before any shared pointer is read
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+			}
+			return epoch_guard { slot, &nesting };
+		}
+
+	private:
+		friend class epoch_domain;
+
+		reader(epoch_domain* domain, detail::epoch_slot* slot) noexcept :
+				domain(domain), slot(slot) {
+		}
+
+		epoch_domain* domain;
+		detail::epoch_slot* slot;
+		int nesting = 0;
+	};
+
+	/// \param max_readers maximum number of readers registered at the same time
+	explicit epoch_domain(std::size_t max_readers = 128) :
+			slots(max_readers) {
+	}
+
+	epoch_domain(const epoch_domain&) = delete;
+	epoch_domain& operator=(const epoch_domain&) = delete;
+
+	/// deletes all retired objects, there must be no registered readers left
+	~epoch_domain() {
+		for (auto& r : retired)
+			r.deleter(r.object);
+	}
+
+	/**
+	 * \brief registers a reading thread
+	 * \throws std::runtime_error if max_readers readers are already registered
+	 */
+	reader register_reader() {
+		for (auto& s : slots) {
+			bool expected = false;
+			if (!s.in_use.load(std::memory_order_relaxed)
+					&& s.in_use.compare_exchange_strong(expected, true, std::memory_order_acquire))
+				return reader { this, &s };
+		}
+		throw std::runtime_error("epoch_domain: too many readers");
+	}
+
+	/**
+	 * \brief schedules \p object for deletion with \p deleter
+	 *
+	 * \p object must no longer be reachable for readers which pin from now on.
+	 */
+	void retire(void* object, void (*deleter)(void*)) {
+		std::lock_guard<std::mutex> lock { retire_mutex };
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		retired.push_back( { object, deleter, global_epoch.load(std::memory_order_relaxed) });
+		collect_locked();
+	}
+
+	/// schedules \p object for deletion with delete
+	template<class T>
+	void retire(T* object) {
+		retire(object, [](void* p) { delete static_cast<T*>(p); });
+	}
+
+	/**
+	 * \brief tries to advance the epoch and reclaims all objects which are safe to delete
+	 * \return number of objects still waiting for reclamation
+	 */
+	std::size_t collect() {
+		std::lock_guard<std::mutex> lock { retire_mutex };
+		collect_locked();
+		return retired.size();
+	}
+
+	/// current global epoch, mostly useful for tests
+	std::uint64_t epoch() const noexcept {
+		return global_epoch.load(std::memory_order_relaxed);
+	}
+
+private:
+	bool try_advance() noexcept {
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		auto current = global_epoch.load(std::memory_order_relaxed);
+		for (auto& s : slots) {
+			const auto pinned = s.epoch.load(std::memory_order_relaxed);
+			if (pinned != 0 && pinned != current)
+				return false;
+		}
+		std::atomic_thread_fence(std::memory_order_acquire);
+		return global_epoch.compare_exchange_strong(current, current + 1, std::memory_order_seq_cst);
+	}
+
+	void collect_locked() {
+		try_advance();
+		const auto safe = global_epoch.load(std::memory_order_acquire);
+		auto keep = retired.begin();
+		for (auto it = retired.begin(); it != retired.end(); ++it) {
+			if (it->epoch + 2 <= safe)
+				it->deleter(it->object);
+			else
+				*keep++ = *it;
+		}
+		retired.erase(keep, retired.end());
+	}
+
+	std::atomic<std::uint64_t> global_epoch { 1 };
+	std::vector<detail::epoch_slot> slots;
+
+	std::mutex retire_mutex;
+	std::vector<detail::retired_object> retired;
+};
+
+#endif /* BUBBLES_EPOCH_RECLAMATION_HPP_ */
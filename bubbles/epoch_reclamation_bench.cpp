@@ -0,0 +1,106 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Caspar Kielwein
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "epoch_reclamation.hpp"
+#include "benchmark.hpp"
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+/*
+ * Read heavy access to a shared routing table, which is replaced continuously.
+ * Compares epoch_domain with std::atomic_load/std::atomic_store on a std::shared_ptr.
+ * Each iteration is one read on each of the reader threads.
+ */
+
+namespace {
+
+struct routing_table {
+	long routes[16];
+};
+
+constexpr int reader_threads = 4;
+
+template<class Read, class Update>
+void run(std::size_t reads, Read read, Update update) {
+	std::atomic<int> running { reader_threads };
+	std::vector<std::thread> readers;
+	for (int t = 0; t < reader_threads; ++t) {
+		readers.emplace_back([&] {
+			read(reads);
+			--running;
+		});
+	}
+	for (long i = 0; running.load() != 0; ++i) {
+		update(i);
+		std::this_thread::yield();
+	}
+	for (auto& r : readers)
+		r.join();
+}
+
+std::shared_ptr<routing_table> shared = std::make_shared<routing_table>();
+
+BENCHMARK("std::atomic_load(std::shared_ptr)", [](std::size_t iterations) {
+	run(iterations, [](std::size_t reads) {
+		long sum = 0;
+		for (std::size_t i = 0; i < reads; ++i) {
+			const auto table = std::atomic_load(&shared);
+			sum += table->routes[i % 16];
+		}
+		do_not_optimize(sum);
+	}, [](long i) {
+		auto table = std::make_shared<routing_table>();
+		table->routes[0] = i;
+		std::atomic_store(&shared, std::move(table));
+	});
+});
+
+epoch_domain domain;
+std::atomic<routing_table*> current { new routing_table { } };
+
+BENCHMARK("epoch_domain", [](std::size_t iterations) {
+	run(iterations, [](std::size_t reads) {
+		auto reader = domain.register_reader();
+		long sum = 0;
+		for (std::size_t i = 0; i < reads; ++i) {
+			auto guard = reader.pin();
+			const auto* table = current.load(std::memory_order_acquire);
+			sum += table->routes[i % 16];
+		}
+		do_not_optimize(sum);
+	}, [](long i) {
+		auto* table = new routing_table { };
+		table->routes[0] = i;
+		domain.retire(current.exchange(table));
+	});
+});
+
+} // namespace
@@ -0,0 +1,155 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Caspar Kielwein
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "epoch_reclamation.hpp"
+
+#include <atomic>
+#include <cassert>
+#include <thread>
+#include <vector>
+
+/// snapshot which records if it was reclaimed instead of freeing its memory
+struct snapshot {
+	long value;
+	std::atomic<bool> reclaimed { false };
+
+	explicit snapshot(long v) :
+			value(v) {
+	}
+};
+
+void mark_reclaimed(void* p) {
+	static_cast<snapshot*>(p)->reclaimed.store(true);
+}
+
+void basic_usage() {
+	epoch_domain domain { 4 };
+	auto reader = domain.register_reader();
+
+	int deleted = 0;
+	auto count_delete = [](void* p) { ++*static_cast<int*>(p); };
+
+	{
+		auto guard = reader.pin();
+		auto nested = reader.pin();
+		domain.retire(&deleted, count_delete);
+		for (int i = 0; i < 10; ++i)
+			domain.collect();
+		assert(deleted == 0); //reader is still pinned
+		nested.release();
+		domain.collect();
+		assert(deleted == 0); //outer guard still pins the reader
+	}
+
+	while (domain.collect() != 0) {
+	}
+	assert(deleted == 1);
+
+	//moved guards unpin only once
+	{
+		auto guard = reader.pin();
+		auto moved = std::move(guard);
+		domain.retire(&deleted, count_delete);
+		domain.collect();
+		domain.collect();
+		assert(deleted == 1);
+	}
+	while (domain.collect() != 0) {
+	}
+	assert(deleted == 2);
+
+	//readers free their slots
+	{
+		auto a = domain.register_reader();
+		auto b = domain.register_reader();
+		auto c = domain.register_reader();
+		bool thrown = false;
+		try {
+			domain.register_reader();
+		} catch (const std::runtime_error&) {
+			thrown = true;
+		}
+		assert(thrown);
+	}
+	auto again = domain.register_reader();
+
+	//retired objects are deleted by the domain at the latest
+	epoch_domain short_lived;
+	short_lived.retire(new snapshot { 0 });
+}
+
+/// readers check that a snapshot they hold is never reclaimed
+void stress() {
+	constexpr int readers = 4;
+	constexpr int updates = 20000;
+
+	epoch_domain domain;
+	std::atomic<snapshot*> current { new snapshot { 0 } };
+	std::atomic<bool> done { false };
+	std::atomic<long> violations { 0 };
+
+	std::vector<snapshot*> graveyard;
+	std::vector<std::thread> threads;
+	for (int r = 0; r < readers; ++r) {
+		threads.emplace_back([&] {
+			auto reader = domain.register_reader();
+			while (!done.load()) {
+				auto guard = reader.pin();
+				const snapshot* s = current.load(std::memory_order_acquire);
+				for (int i = 0; i < 16; ++i) {
+					if (s->reclaimed.load())
+						++violations;
+				}
+			}
+		});
+	}
+
+	for (long i = 1; i <= updates; ++i) {
+		auto* old = current.exchange(new snapshot { i });
+		graveyard.push_back(old);
+		domain.retire(old, &mark_reclaimed);
+	}
+	done = true;
+	for (auto& t : threads)
+		t.join();
+
+	assert(violations == 0);
+	while (domain.collect() != 0) {
+	}
+	for (auto* s : graveyard) {
+		assert(s->reclaimed);
+		delete s;
+	}
+	delete current.load();
+}
+
+int main() {
+	basic_usage();
+	stress();
+	return 0;
+}
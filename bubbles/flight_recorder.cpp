@@ -0,0 +1,324 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Caspar Kielwein
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "flight_recorder.hpp"
+#include "bubble_inline.hpp"
+#include "demangle.hpp"
+
+#include <csignal>
+#include <cstdlib>
+#include <exception>
+#include <new>
+#include <string>
+#include <typeinfo>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#if defined(__GLIBC__) || defined(__APPLE__)
+#include <execinfo.h>
+#define BUBBLES_FLIGHT_BACKTRACE 1
+#endif
+
+#ifdef __GNUG__
+#include <cxxabi.h>
+#endif
+
+namespace detail {
+
+/// buffered writer, which only uses write(2), so it can be used in signal handlers
+class flight_writer {
+public:
+	explicit flight_writer(int fd) noexcept :
+			fd { fd } {
+	}
+
+	~flight_writer() {
+		flush();
+	}
+
+	flight_writer& operator<<(const char* s) noexcept {
+		if (!s)
+			s = "(null)";
+		while (*s)
+			put(*s++);
+		return *this;
+	}
+
+	flight_writer& operator<<(char c) noexcept {
+		put(c);
+		return *this;
+	}
+
+	void number(std::uint64_t v, unsigned base = 10) noexcept {
+		char digits[24];
+		int n = 0;
+		do {
+			digits[n++] = "0123456789abcdef"[v % base];
+			v /= base;
+		} while (v);
+		if (base == 16)
+			*this << "0x";
+		while (n)
+			put(digits[--n]);
+	}
+
+	void signed_number(std::int64_t v) noexcept {
+		if (v < 0) {
+			put('-');
+			number(0 - static_cast<std::uint64_t>(v));
+		} else {
+			number(static_cast<std::uint64_t>(v));
+		}
+	}
+
+	/// fixed point with 6 decimals, without locale or allocation
+	void floating_point(double v) noexcept {
+		if (v != v) {
+			*this << "nan";
+			return;
+		}
+		if (v < 0) {
+			put('-');
+			v = -v;
+		}
+		if (v >= 1e19) {
+			*this << "inf";
+			return;
+		}
+		auto integral = static_cast<std::uint64_t>(v);
+		auto fraction = static_cast<std::uint64_t>((v - static_cast<double>(integral)) * 1e6 + 0.5);
+		if (fraction >= 1000000) {
+			++integral;
+			fraction -= 1000000;
+		}
+		number(integral);
+		put('.');
+		for (std::uint64_t d = 100000; d > 0; d /= 10)
+			put(static_cast<char>('0' + fraction / d % 10));
+	}
+
+	void flush() noexcept {
+		const char* p = buffer;
+		while (used > 0) {
+			const auto written = ::write(fd, p, used);
+			if (written <= 0)
+				break;
+			p += written;
+			used -= static_cast<std::size_t>(written);
+		}
+		used = 0;
+	}
+
+private:
+	void put(char c) noexcept {
+		if (used == sizeof(buffer))
+			flush();
+		buffer[used++] = c;
+	}
+
+	int fd;
+	char buffer[4096];
+	std::size_t used = 0;
+};
+
+BUBBLE_INLINE void write_flight_event(flight_writer& out, const flight_event& e) noexcept {
+	out.number(e.time);
+	out << ' ' << e.file << ':';
+	out.number(e.line);
+	out << ' ' << e.function << ' ' << e.message;
+	for (std::uint16_t a = 0; a < e.arg_count && a < 3; ++a) {
+		out << ' ';
+		switch (static_cast<flight_arg_kind>((e.arg_kinds >> (2 * a)) & 3)) {
+		case flight_arg_kind::unsigned_integer:
+			out.number(e.args[a]);
+			break;
+		case flight_arg_kind::signed_integer:
+			out.signed_number(static_cast<std::int64_t>(e.args[a]));
+			break;
+		case flight_arg_kind::floating_point: {
+			double d;
+			std::memcpy(&d, &e.args[a], sizeof(d));
+			out.floating_point(d);
+			break;
+		}
+		case flight_arg_kind::pointer:
+			out.number(e.args[a], 16);
+			break;
+		}
+	}
+	out << '\n';
+}
+
+/// path given to install, in static storage for the signal handler
+struct flight_crash_state {
+	char path[4096] = { };
+	std::atomic<bool> dumped { false };
+	std::terminate_handler previous_terminate = nullptr;
+};
+
+BUBBLE_INLINE flight_crash_state& flight_crash() noexcept {
+	static flight_crash_state state;
+	return state;
+}
+
+BUBBLE_INLINE void flight_signal_handler(int signal) {
+	auto& crash = flight_crash();
+	if (!crash.dumped.exchange(true)) {
+		const int fd = ::open(crash.path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+		if (fd >= 0) {
+			{
+				flight_writer out { fd };
+				out << "fatal signal ";
+				out.number(static_cast<std::uint64_t>(signal));
+				out << "\nstack (mangled):\n";
+			}
+#if BUBBLES_FLIGHT_BACKTRACE
+			void* frames[64];
+			::backtrace_symbols_fd(frames, ::backtrace(frames, 64), fd);
+#endif
+			flight_recorder::dump(fd);
+			::close(fd);
+		}
+	}
+	//the handler was reset to the default action, which now ends the process
+	std::raise(signal);
+}
+
+BUBBLE_INLINE void flight_terminate_handler() {
+	auto& crash = flight_crash();
+	if (!crash.dumped.exchange(true)) {
+		const int fd = ::open(crash.path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+		if (fd >= 0) {
+			{
+				flight_writer out { fd };
+				out << "std::terminate";
+#ifdef __GNUG__
+				if (const auto* type = abi::__cxa_current_exception_type())
+					out << ", uncaught exception of type " << demangle(type->name()).c_str();
+#endif
+				out << "\nstack:\n";
+#if BUBBLES_FLIGHT_BACKTRACE
+				void* frames[64];
+				const int count = ::backtrace(frames, 64);
+				if (char** symbols = ::backtrace_symbols(frames, count)) {
+					for (int i = 0; i < count; ++i) {
+						//symbols look like binary(mangled+0x1f) [0x4005d1], demangle the name between ( and +
+						std::string symbol = symbols[i];
+						const auto open = symbol.find('(');
+						const auto plus = symbol.find('+', open);
+						if (open != std::string::npos && plus != std::string::npos && plus > open + 1)
+							symbol.replace(open + 1, plus - open - 1, demangle(symbol.substr(open + 1, plus - open - 1).c_str()));
+						out << symbol.c_str() << '\n';
+					}
+					std::free(symbols);
+				}
+#endif
+			}
+			flight_recorder::dump(fd);
+			::close(fd);
+		}
+	}
+	if (crash.previous_terminate)
+		crash.previous_terminate();
+	std::abort();
+}
+
+} // namespace detail
+
+BUBBLE_INLINE flight_recorder::buffer* flight_recorder::acquire_buffer() noexcept {
+	const auto index = thread_index();
+	if (index >= max_threads)
+		return nullptr;
+	auto& slot = buffers()[index];
+	auto* b = slot.load(std::memory_order_acquire);
+	if (!b) {
+		b = new (std::nothrow) buffer;
+		if (!b)
+			return nullptr;
+		b->thread = index;
+		slot.store(b, std::memory_order_release);
+	}
+	return b;
+}
+
+BUBBLE_INLINE void flight_recorder::dump(int fd) noexcept {
+	detail::flight_writer out { fd };
+	for (std::size_t t = 0; t < max_threads; ++t) {
+		const auto* b = buffers()[t].load(std::memory_order_acquire);
+		if (!b)
+			continue;
+		const auto next = b->next.load(std::memory_order_acquire);
+		const auto first = next > events_per_thread ? next - events_per_thread : 0;
+		out << "thread ";
+		out.number(b->thread);
+		out << ", ";
+		out.number(next - first);
+		out << " events\n";
+		//events of running threads might be overwritten while they are written
+		for (auto i = first; i < next; ++i)
+			detail::write_flight_event(out, b->events[i % events_per_thread]);
+	}
+}
+
+BUBBLE_INLINE bool flight_recorder::dump(const char* path) noexcept {
+	const int fd = ::open(path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+	if (fd < 0)
+		return false;
+	dump(fd);
+	::close(fd);
+	return true;
+}
+
+BUBBLE_INLINE void flight_recorder::install(const char* path) {
+	auto& crash = detail::flight_crash();
+	std::strncpy(crash.path, path, sizeof(crash.path) - 1);
+	crash.dumped = false;
+
+	//backtrace loads libgcc on first use, which is not safe in a signal handler
+#if BUBBLES_FLIGHT_BACKTRACE
+	void* frames[1];
+	::backtrace(frames, 1);
+#endif
+
+	//stack overflows need another stack for the handler
+	static char alternate_stack[64 * 1024];
+	stack_t stack { };
+	stack.ss_sp = alternate_stack;
+	stack.ss_size = sizeof(alternate_stack);
+	::sigaltstack(&stack, nullptr);
+
+	struct sigaction action { };
+	action.sa_handler = detail::flight_signal_handler;
+	action.sa_flags = SA_ONSTACK | SA_RESETHAND;
+	sigemptyset(&action.sa_mask);
+	for (int signal : { SIGSEGV, SIGBUS, SIGFPE, SIGILL, SIGABRT })
+		::sigaction(signal, &action, nullptr);
+
+	crash.previous_terminate = std::set_terminate(detail::flight_terminate_handler);
+}
@@ -0,0 +1,228 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Caspar Kielwein
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef BUBBLES_FLIGHT_RECORDER_HPP_
+#define BUBBLES_FLIGHT_RECORDER_HPP_
+
+#include "scope_exit.hpp"
+#include "thread_index.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+/*
+ * Always on flight recorder: every thread records its last events in a circular buffer in memory.
+ * After a crash the buffers of all threads are dumped to a file.
+ *
+ * Recording an event only stores the time, pointers to string literals and up to three numbers,
+ * formatting happens when the buffers are dumped.
+ * ~~~{.cpp}
+ * int main() {
+ *     flight_recorder::install("crash.flight"); //dump on fatal signals and std::terminate
+ *     auto guard = flight_recorder::dump_on_failure("failure.flight");
+ *     FLIGHT_RECORD("request", id, bytes);
+ *     FLIGHT_TRACE();
+ * }
+ * ~~~
+ * Dumps from signal handlers only use async-signal-safe functions.
+ * Because demangling allocates, stack frames in those dumps are mangled, pipe them through c++filt.
+ * Dumps after std::terminate name the type of the uncaught exception and the stack frames demangled.
+ * Requires POSIX.
+ */
+
+/// an event in the flight recorder, 64 bytes
+struct flight_event {
+	/// time stamp counter on x86, nanoseconds of steady_clock elsewhere
+	std::uint64_t time;
+	const char* message;
+	const char* file;
+	const char* function;
+	std::uint32_t line;
+	std::uint16_t arg_count;
+	/// kind of each argument, two bits per argument
+	std::uint16_t arg_kinds;
+	std::uint64_t args[3];
+};
+
+namespace detail {
+
+enum class flight_arg_kind : std::uint16_t {
+	unsigned_integer, signed_integer, floating_point, pointer
+};
+
+inline std::uint64_t flight_clock() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+	return __rdtsc();
+#else
+	return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+template<class T>
+constexpr flight_arg_kind flight_kind() noexcept {
+	static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value || std::is_pointer<T>::value,
+			"flight recorder arguments must be numbers, enums or pointers");
+	return std::is_pointer<T>::value ? flight_arg_kind::pointer
+			: std::is_floating_point<T>::value ? flight_arg_kind::floating_point
+			: std::is_signed<T>::value ? flight_arg_kind::signed_integer
+			: flight_arg_kind::unsigned_integer;
+}
+
+template<class T>
+std::uint64_t flight_bits(T v, std::true_type /*floating point*/) noexcept {
+	const double d = v;
+	std::uint64_t bits;
+	std::memcpy(&bits, &d, sizeof(bits));
+	return bits;
+}
+
+template<class T>
+std::uint64_t flight_bits(T v, std::false_type) noexcept {
+	return static_cast<std::uint64_t>(v);
+}
+
+template<class T>
+std::uint64_t flight_bits(T* v, std::false_type) noexcept {
+	return reinterpret_cast<std::uintptr_t>(v);
+}
+
+template<class T>
+std::uint64_t flight_bits(T v) noexcept {
+	return flight_bits(v, std::is_floating_point<T> { });
+}
+
+} // namespace detail
+
+/**
+ * \brief per thread circular event buffers, which are dumped after crashes.
+ *
+ * Each thread, identified by its thread_index, gets a buffer of the last events_per_thread events
+ * on its first event. Buffers are never freed, so that they can be dumped at any time.
+ * Threads reusing the index of an exited thread continue its buffer.
+ * Threads beyond max_threads are not recorded.
+ *
+ * \author ckielwein
+ */
+class flight_recorder {
+public:
+	static constexpr std::size_t events_per_thread = 1024;
+	static constexpr std::size_t max_threads = 256;
+
+	/// records an event of the calling thread, use FLIGHT_RECORD instead
+	template<class ... Args>
+	static void record(const char* file, std::uint32_t line, const char* function, const char* message,
+			Args ... args) noexcept {
+		static_assert(sizeof...(Args) <= 3, "the flight recorder stores up to 3 arguments per event");
+		auto* b = local_buffer();
+		if (!b)
+			return;
+		const auto i = b->next.load(std::memory_order_relaxed);
+		auto& e = b->events[i % events_per_thread];
+		e.time = detail::flight_clock();
+		e.message = message;
+		e.file = file;
+		e.function = function;
+		e.line = line;
+		e.arg_count = sizeof...(Args);
+		const std::uint64_t values[] = { 0, detail::flight_bits(args)... };
+		const detail::flight_arg_kind kinds[] = { detail::flight_arg_kind::unsigned_integer, detail::flight_kind<Args>()... };
+		std::uint16_t packed = 0;
+		for (std::size_t a = 0; a < sizeof...(Args); ++a) {
+			e.args[a] = values[a + 1];
+			packed |= static_cast<std::uint16_t>(static_cast<std::uint16_t>(kinds[a + 1]) << (2 * a));
+		}
+		e.arg_kinds = packed;
+		//the dump reads events up to next
+		b->next.store(i + 1, std::memory_order_release);
+	}
+
+	/// writes the events of all threads to \p fd, oldest first. Async-signal-safe.
+	static void dump(int fd) noexcept;
+
+	/// writes the events of all threads to a new file at \p path. Async-signal-safe.
+	/// \return false if the file could not be created
+	static bool dump(const char* path) noexcept;
+
+	/**
+	 * \brief dumps to \p path on fatal signals and when std::terminate is called.
+	 *
+	 * Handles SIGSEGV, SIGBUS, SIGFPE, SIGILL and SIGABRT on an alternate stack,
+	 * which is installed for the calling thread, so stack overflows of this thread are dumped too.
+	 * After the dump the signal is raised again with its default action.
+	 * Call it once, early in main.
+	 */
+	static void install(const char* path);
+
+	/// scope_failure, which dumps to \p path if the scope is left by an exception
+	static auto dump_on_failure(const char* path) {
+		return scope_failure([path] {
+			dump(path);
+		});
+	}
+
+private:
+	struct buffer {
+		std::atomic<std::uint64_t> next { 0 };
+		std::size_t thread = 0;
+		flight_event events[events_per_thread];
+	};
+
+	static std::atomic<buffer*>* buffers() noexcept {
+		static std::atomic<buffer*> all[max_threads] { };
+		return all;
+	}
+
+	static buffer* local_buffer() noexcept {
+		thread_local buffer* const b = acquire_buffer();
+		return b;
+	}
+
+	static buffer* acquire_buffer() noexcept;
+};
+
+/// records an event with a string literal message and up to three numbers or pointers
+#define FLIGHT_RECORD(...) \
+	flight_recorder::record(__FILE__, __LINE__, __FUNCTION__, __VA_ARGS__)
+
+/// records file, function and line, like PRINT_TRACE
+#define FLIGHT_TRACE() \
+	FLIGHT_RECORD("trace")
+
+#if BUBBLE_HEADER_ONLY
+	#include "flight_recorder.cpp"
+#endif
+#endif /* BUBBLES_FLIGHT_RECORDER_HPP_ */
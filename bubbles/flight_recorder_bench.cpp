@@ -0,0 +1,58 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Caspar Kielwein
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "flight_recorder.hpp"
+#include "benchmark.hpp"
+
+/*
+ * Steady state cost of recording an event in the flight recorder,
+ * compared to reading the clock, which every event does.
+ * In virtual machines, which trap rdtsc, the clock dominates.
+ */
+
+namespace {
+
+std::uint64_t request = 0;
+
+BENCHMARK("flight recorder clock", [] {
+	do_not_optimize(detail::flight_clock());
+});
+
+BENCHMARK("FLIGHT_TRACE", [] {
+	FLIGHT_TRACE();
+});
+
+BENCHMARK("FLIGHT_RECORD, 1 argument", [] {
+	FLIGHT_RECORD("request", ++request);
+});
+
+BENCHMARK("FLIGHT_RECORD, 3 arguments", [] {
+	FLIGHT_RECORD("request", ++request, -1, 0.5);
+});
+
+} // namespace
@@ -0,0 +1,139 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Caspar Kielwein
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "flight_recorder.hpp"
+
+#include <cassert>
+#include <csignal>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+std::string read_file(const char* path) {
+	std::ifstream in { path };
+	std::stringstream content;
+	content << in.rdbuf();
+	return content.str();
+}
+
+bool contains(const std::string& text, const char* part) {
+	return text.find(part) != std::string::npos;
+}
+
+/// runs \p crash in a child process, returns the signal which ended it
+template<class F>
+int crash_child(F crash) {
+	const auto pid = fork();
+	if (pid == 0) {
+		crash();
+		_exit(0);
+	}
+	int status = 0;
+	waitpid(pid, &status, 0);
+	return WIFSIGNALED(status) ? WTERMSIG(status) : 0;
+}
+
+void throw_uncaught() {
+	throw std::runtime_error("unhandled");
+}
+
+int main() {
+	const char* path = "flight_recorder_test.flight";
+
+	FLIGHT_RECORD("request", 42u, -7, 2.5);
+	FLIGHT_TRACE();
+	int local = 0;
+	FLIGHT_RECORD("pointer", &local);
+	std::thread { [] {
+		FLIGHT_RECORD("worker started");
+	} }.join();
+
+	assert(flight_recorder::dump(path));
+	auto dump = read_file(path);
+	assert(contains(dump, "thread 0, 3 events"));
+	assert(contains(dump, "main request 42 -7 2.500000\n"));
+	assert(contains(dump, "main trace\n"));
+	assert(contains(dump, "main pointer 0x"));
+	assert(contains(dump, "worker started"));
+
+	//only the last events_per_thread events are kept
+	for (std::size_t i = 0; i < flight_recorder::events_per_thread + 10; ++i)
+		FLIGHT_RECORD("loop", i);
+	assert(flight_recorder::dump(path));
+	dump = read_file(path);
+	assert(contains(dump, "events\n"));
+	assert(!contains(dump, "main request"));
+	assert(!contains(dump, "loop 9\n"));
+	assert(contains(dump, "loop 10\n"));
+
+	//scope_failure dumps if the scope is left by an exception
+	std::remove(path);
+	try {
+		auto guard = flight_recorder::dump_on_failure(path);
+		FLIGHT_RECORD("before failure");
+		throw std::runtime_error("failure");
+	} catch (const std::runtime_error&) {
+	}
+	assert(contains(read_file(path), "before failure"));
+	std::remove(path);
+	{
+		auto guard = flight_recorder::dump_on_failure(path);
+	}
+	assert(read_file(path).empty());
+
+	//dump from the signal handler on a fatal signal
+	const auto signal = crash_child([path] {
+		flight_recorder::install(path);
+		FLIGHT_RECORD("about to crash", 13);
+		std::raise(SIGSEGV);
+	});
+	assert(signal == SIGSEGV);
+	dump = read_file(path);
+	assert(contains(dump, "fatal signal 11"));
+	assert(contains(dump, "about to crash 13"));
+	std::remove(path);
+
+	//dump on std::terminate, with the demangled type of the uncaught exception
+	const auto aborted = crash_child([path] {
+		flight_recorder::install(path);
+		FLIGHT_RECORD("about to throw");
+		throw_uncaught();
+	});
+	assert(aborted == SIGABRT);
+	dump = read_file(path);
+	assert(contains(dump, "uncaught exception of type std::runtime_error"));
+	assert(contains(dump, "\nstack:\n"));
+	assert(contains(dump, "about to throw"));
+	std::remove(path);
+}
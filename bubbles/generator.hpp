@@ -0,0 +1,320 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Caspar Kielwein
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef BUBBLES_GENERATOR_HPP_
+#define BUBBLES_GENERATOR_HPP_
+
+#include "power_of_two.hpp"
+
+#include <array>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/**
+ * \brief frame allocator of generator, which uses global operator new and delete.
+ *
+ * A frame allocator is a type with the static functions
+ * void* allocate(std::size_t) and void deallocate(void*, std::size_t).
+ */
+struct default_frame_allocator {
+	static void* allocate(std::size_t size) {
+		return ::operator new(size);
+	}
+
+	static void deallocate(void* frame, std::size_t size) noexcept {
+		::operator delete(frame, size);
+	}
+};
+
+/**
+ * \brief frame allocator of generator, which keeps freed frames for reuse on the same thread.
+ *
+ * Frames are rounded up to size classes of powers of two from 64 to 4096 bytes,
+ * larger frames come directly from operator new.
+ * Each thread caches up to max_cached frames per size class,
+ * so generators created and destroyed in a loop do not allocate after the first one.
+ * A frame freed on another thread than it was allocated on goes to the cache of the freeing thread.
+ */
+class recycling_frame_allocator {
+public:
+	static constexpr std::size_t min_frame = 64;
+	static constexpr std::size_t max_frame = 4096;
+	static constexpr std::size_t max_cached = 32;
+
+	static void* allocate(std::size_t size) {
+		if (size > max_frame)
+			return ::operator new(size);
+		auto& list = cache().lists[size_class(size)];
+		if (!list.head)
+			return ::operator new(class_size(size));
+		auto* frame = list.head;
+		list.head = frame->next;
+		--list.count;
+		return frame;
+	}
+
+	static void deallocate(void* frame, std::size_t size) noexcept {
+		if (size > max_frame) {
+			::operator delete(frame, size);
+			return;
+		}
+		auto& list = cache().lists[size_class(size)];
+		if (list.count == max_cached) {
+			::operator delete(frame, class_size(size));
+			return;
+		}
+		list.head = ::new (frame) node { list.head };
+		++list.count;
+	}
+
+	/// number of frames cached by the calling thread
+	static std::size_t cached_frames() noexcept {
+		std::size_t count = 0;
+		for (const auto& list : cache().lists)
+			count += list.count;
+		return count;
+	}
+
+private:
+	struct node {
+		node* next;
+	};
+
+	struct free_list {
+		node* head = nullptr;
+		std::size_t count = 0;
+	};
+
+	static constexpr std::size_t class_count = 7; //64 to 4096
+
+	struct frame_cache {
+		~frame_cache() {
+			std::size_t size = min_frame;
+			for (auto& list : lists) {
+				while (list.head)
+					::operator delete(std::exchange(list.head, list.head->next), size);
+				size *= 2;
+			}
+		}
+
+		std::array<free_list, class_count> lists;
+	};
+
+	static frame_cache& cache() noexcept {
+		thread_local frame_cache c;
+		return c;
+	}
+
+	static std::size_t class_size(std::size_t size) noexcept {
+		return size < min_frame ? min_frame : next_power_of_two(size);
+	}
+
+	static std::size_t size_class(std::size_t size) noexcept {
+		std::size_t c = 0;
+		for (auto s = class_size(size); s > min_frame; s /= 2)
+			++c;
+		return c;
+	}
+};
+
+/**
+ * \brief lazy sequence of values, produced by a coroutine with co_yield.
+ *
+ * The coroutine runs only as far as the consumer iterates, nothing is materialized.
+ * generator is a move only input range, it can be iterated once.
+ * It works with range based for, make_range and print_range.
+ * ~~~{.cpp}
+ * generator<record> decode(std::string_view input) {
+ *     while (!input.empty())
+ *         co_yield decode_next(input);
+ * }
+ * for (const auto& r : decode(input))
+ *     handle(r);
+ * print_range(decode(input));
+ * ~~~
+ * Exceptions thrown by the coroutine propagate to the consumer.
+ *
+ * \tparam T type of the yielded values, which are passed by reference without copying
+ * \tparam FrameAllocator allocates the coroutine frames, e.g. recycling_frame_allocator
+ * Requires C++20.
+ *
+ * \author ckielwein
+ */
+template<class T, class FrameAllocator = default_frame_allocator>
+class generator {
+	static_assert(!std::is_reference<T>::value, "generator yields values, references are taken internally");
+
+public:
+	struct promise_type {
+		generator get_return_object() noexcept {
+			return generator { std::coroutine_handle<promise_type>::from_promise(*this) };
+		}
+
+		std::suspend_always initial_suspend() const noexcept {
+			return { };
+		}
+
+		std::suspend_always final_suspend() const noexcept {
+			return { };
+		}
+
+		/// the yielded value, even a temporary, lives until the coroutine is resumed
+		std::suspend_always yield_value(const T& v) noexcept {
+			value = std::addressof(v);
+			return { };
+		}
+
+		void return_void() const noexcept {
+		}
+
+		void unhandled_exception() noexcept {
+			exception = std::current_exception();
+		}
+
+		/// generators only yield, they cannot co_await
+		template<class U>
+		std::suspend_never await_transform(U&&) = delete;
+
+		static void* operator new(std::size_t size) {
+			return FrameAllocator::allocate(size);
+		}
+
+		static void operator delete(void* frame, std::size_t size) noexcept {
+			FrameAllocator::deallocate(frame, size);
+		}
+
+		const T* value = nullptr;
+		std::exception_ptr exception;
+	};
+
+	using handle_type = std::coroutine_handle<promise_type>;
+
+	class iterator {
+	public:
+		using iterator_category = std::input_iterator_tag;
+		using value_type = std::remove_cv_t<T>;
+		using difference_type = std::ptrdiff_t;
+		using pointer = const T*;
+		using reference = const T&;
+
+		iterator() noexcept = default;
+
+		reference operator*() const noexcept {
+			return *coroutine.promise().value;
+		}
+
+		pointer operator->() const noexcept {
+			return coroutine.promise().value;
+		}
+
+		iterator& operator++() {
+			resume(coroutine);
+			return *this;
+		}
+
+		void operator++(int) {
+			++*this;
+		}
+
+		/// only comparisons with end() are meaningful
+		friend bool operator==(const iterator& l, const iterator& r) noexcept {
+			return l.done() == r.done();
+		}
+
+		friend bool operator!=(const iterator& l, const iterator& r) noexcept {
+			return !(l == r);
+		}
+
+	private:
+		friend class generator;
+		explicit iterator(handle_type h) noexcept :
+				coroutine { h } {
+		}
+
+		bool done() const noexcept {
+			return !coroutine || coroutine.done();
+		}
+
+		handle_type coroutine;
+	};
+
+	generator(generator&& other) noexcept :
+			coroutine { std::exchange(other.coroutine, nullptr) } {
+	}
+
+	generator& operator=(generator&& other) noexcept {
+		std::swap(coroutine, other.coroutine);
+		return *this;
+	}
+
+	~generator() {
+		if (coroutine)
+			coroutine.destroy();
+	}
+
+	/// runs the coroutine to the first co_yield, call begin only once, a moved from generator is empty
+	iterator begin() {
+		if (!coroutine)
+			return end();
+		resume(coroutine);
+		return iterator { coroutine };
+	}
+
+	iterator end() noexcept {
+		return iterator { };
+	}
+
+	friend iterator begin(generator& g) {
+		return g.begin();
+	}
+
+	friend iterator end(generator& g) noexcept {
+		return g.end();
+	}
+
+private:
+	explicit generator(handle_type h) noexcept :
+			coroutine { h } {
+	}
+
+	static void resume(handle_type h) {
+		h.resume();
+		if (h.promise().exception)
+			std::rethrow_exception(std::exchange(h.promise().exception, nullptr));
+	}
+
+	handle_type coroutine;
+};
+
+#endif /* BUBBLES_GENERATOR_HPP_ */
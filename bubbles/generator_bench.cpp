@@ -0,0 +1,166 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Caspar Kielwein
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "generator.hpp"
+#include "benchmark.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+/*
+ * Producing and consuming a stream of 1000 records with a generator compared to materializing
+ * them in a std::vector first, with the default and with the recycling frame allocator.
+ * The peak memory of both approaches for 1M records is reported once on stderr.
+ */
+
+namespace {
+
+struct record {
+	int id;
+	double value;
+};
+
+record decode(int i) {
+	return { i, i * 0.5 };
+}
+
+template<class Allocator = std::allocator<record>>
+std::vector<record, Allocator> materialize(int count) {
+	std::vector<record, Allocator> records;
+	for (int i = 0; i < count; ++i)
+		records.push_back(decode(i));
+	return records;
+}
+
+template<class Allocator>
+generator<record, Allocator> stream(int count) {
+	for (int i = 0; i < count; ++i)
+		co_yield decode(i);
+}
+
+/// remembers the size of the largest frame
+struct measuring_frame_allocator {
+	static void* allocate(std::size_t size) {
+		largest = std::max(largest, size);
+		return default_frame_allocator::allocate(size);
+	}
+
+	static void deallocate(void* frame, std::size_t size) noexcept {
+		default_frame_allocator::deallocate(frame, size);
+	}
+
+	static std::size_t largest;
+};
+
+std::size_t measuring_frame_allocator::largest = 0;
+
+std::size_t allocated_bytes = 0;
+std::size_t peak_bytes = 0;
+
+/// counts the bytes held by a container in allocated_bytes, and their peak in peak_bytes
+template<class T>
+struct counting_allocator {
+	using value_type = T;
+
+	counting_allocator() noexcept = default;
+
+	template<class U>
+	counting_allocator(const counting_allocator<U>&) noexcept {
+	}
+
+	T* allocate(std::size_t n) {
+		allocated_bytes += n * sizeof(T);
+		peak_bytes = std::max(peak_bytes, allocated_bytes);
+		return std::allocator<T> { }.allocate(n);
+	}
+
+	void deallocate(T* p, std::size_t n) noexcept {
+		allocated_bytes -= n * sizeof(T);
+		std::allocator<T> { }.deallocate(p, n);
+	}
+
+	friend bool operator==(const counting_allocator&, const counting_allocator&) noexcept {
+		return true;
+	}
+};
+
+constexpr int records_per_stream = 1000;
+
+/// reports the peak memory once, on first use so that filtered runs do not pay for it
+void report_memory() {
+	static const bool reported = [] {
+		constexpr int count = 1000000;
+		double sum = 0;
+		for (const auto& r : materialize<counting_allocator<record>>(count))
+			sum += r.value;
+		for (const auto& r : stream<measuring_frame_allocator>(count))
+			sum += r.value;
+		do_not_optimize(sum);
+		std::cerr << count << " records, std::vector peak: " << peak_bytes / 1024
+				<< " KiB, generator frame: " << measuring_frame_allocator::largest << " bytes\n";
+		return true;
+	}();
+	do_not_optimize(reported);
+}
+
+BENCHMARK("std::vector, 1000 records", [] {
+	report_memory();
+	double sum = 0;
+	for (const auto& r : materialize(records_per_stream))
+		sum += r.value;
+	do_not_optimize(sum);
+});
+
+BENCHMARK("generator, 1000 records", [] {
+	report_memory();
+	double sum = 0;
+	for (const auto& r : stream<default_frame_allocator>(records_per_stream))
+		sum += r.value;
+	do_not_optimize(sum);
+});
+
+BENCHMARK("generator with recycled frames, 1000 records", [] {
+	double sum = 0;
+	for (const auto& r : stream<recycling_frame_allocator>(records_per_stream))
+		sum += r.value;
+	do_not_optimize(sum);
+});
+
+BENCHMARK("generator with recycled frames, 1 record", [] {
+	for (const auto& r : stream<recycling_frame_allocator>(1))
+		do_not_optimize(r);
+});
+
+BENCHMARK("generator, 1 record", [] {
+	for (const auto& r : stream<default_frame_allocator>(1))
+		do_not_optimize(r);
+});
+
+} // namespace
@@ -0,0 +1,137 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Caspar Kielwein
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "generator.hpp"
+#include "pair_range.hpp"
+#include "prettyprint.hpp"
+
+#include <cassert>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+generator<int> iota(int first, int last) {
+	for (int i = first; i < last; ++i)
+		co_yield i;
+}
+
+generator<std::string, recycling_frame_allocator> words(int count) {
+	for (int i = 0; i < count; ++i)
+		co_yield "word" + std::to_string(i);
+}
+
+generator<int> failing() {
+	co_yield 1;
+	throw std::runtime_error("decode error");
+}
+
+int alive = 0;
+
+struct tracked {
+	tracked() {
+		++alive;
+	}
+	tracked(const tracked&) = delete;
+	~tracked() {
+		--alive;
+	}
+};
+
+generator<int> holding() {
+	tracked t;
+	for (int i = 0;; ++i)
+		co_yield i;
+}
+
+int main() {
+	std::vector<int> values;
+	for (int i : iota(0, 5))
+		values.push_back(i);
+	assert((values == std::vector<int> { 0, 1, 2, 3, 4 }));
+
+	auto empty = iota(0, 0);
+	assert(empty.begin() == empty.end());
+
+	//yielded temporaries are not copied before the consumer sees them
+	std::vector<std::string> collected;
+	for (const auto& w : words(3))
+		collected.push_back(w);
+	assert((collected == std::vector<std::string> { "word0", "word1", "word2" }));
+
+	//works with PairRange and print_range
+	auto g = iota(1, 4);
+	int sum = 0;
+	for (int i : make_range(g.begin(), g.end()))
+		sum += i;
+	assert(sum == 6);
+
+	std::ostringstream out;
+	auto* original = std::cout.rdbuf(out.rdbuf());
+	print_range(iota(1, 4));
+	print_range(iota(0, 0));
+	std::cout.rdbuf(original);
+	assert(out.str() == "[1, 2, 3]\nrange empty");
+
+	//exceptions propagate to the consumer
+	bool thrown = false;
+	try {
+		for (int i : failing())
+			assert(i == 1);
+	} catch (const std::runtime_error&) {
+		thrown = true;
+	}
+	assert(thrown);
+
+	//leaving the loop early destroys the suspended coroutine and its locals
+	{
+		auto h = holding();
+		for (int i : h)
+			if (i == 3)
+				break;
+		assert(alive == 1);
+	}
+	assert(alive == 0);
+
+	//moving transfers the coroutine
+	auto first = iota(0, 2);
+	auto second = std::move(first);
+	assert(*second.begin() == 0);
+	//the moved from generator is empty
+	assert(first.begin() == first.end());
+
+	//recycled frames are reused
+	const auto cached = recycling_frame_allocator::cached_frames();
+	assert(cached >= 1);
+	{
+		auto w = words(1);
+		assert(recycling_frame_allocator::cached_frames() == cached - 1);
+	}
+	assert(recycling_frame_allocator::cached_frames() == cached);
+}
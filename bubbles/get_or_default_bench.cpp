@@ -0,0 +1,75 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Caspar Kielwein
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "get_or_default.hpp"
+#include "benchmark.hpp"
+
+#include <map>
+#include <unordered_map>
+
+/*
+ * Compares get_or_default with a hand written find and compare.
+ */
+
+namespace {
+
+template<class Map>
+Map make_map() {
+	Map m;
+	for (int i = 0; i < 1000; i += 2)
+		m[i] = i;
+	return m;
+}
+
+const auto ordered = make_map<std::map<int, int>>();
+const auto unordered = make_map<std::unordered_map<int, int>>();
+int key = 0;
+
+template<class Map>
+int hand_written(const Map& m, int k) {
+	const auto it = m.find(k);
+	return it != m.end() ? it->second : -1;
+}
+
+BENCHMARK("find, std::map", [] {
+	do_not_optimize(hand_written(ordered, key++ % 1000));
+});
+
+BENCHMARK("get_or_default, std::map", [] {
+	do_not_optimize(get_or_default(ordered, key++ % 1000, -1));
+});
+
+BENCHMARK("find, std::unordered_map", [] {
+	do_not_optimize(hand_written(unordered, key++ % 1000));
+});
+
+BENCHMARK("get_or_default, std::unordered_map", [] {
+	do_not_optimize(get_or_default(unordered, key++ % 1000, -1));
+});
+
+} // namespace
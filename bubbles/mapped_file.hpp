@@ -0,0 +1,232 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Caspar Kielwein
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef BUBBLES_MAPPED_FILE_HPP_
+#define BUBBLES_MAPPED_FILE_HPP_
+
+#include "pair_range.hpp"
+
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/*
+ * Zero copy iteration over lines and records of text files.
+ *
+ * mapped_file maps a whole file read only into memory,
+ * lines and records yield std::string_view into it, without copying.
+ * The search for delimiters uses memchr, which the C library vectorizes.
+ * split_records cuts text into chunks on record boundaries, to scan them on multiple threads.
+ * ~~~{.cpp}
+ * mapped_file log { "server.log" };
+ * for (std::string_view line : lines(log.view()))
+ *     if (line.find("ERROR") != std::string_view::npos)
+ *         ++errors;
+ * ~~~
+ * Requires POSIX mmap.
+ */
+
+/**
+ * \brief read only memory mapping of a whole file.
+ *
+ * The mapping is move only and unmapped on destruction.
+ * Views into it must not outlive it.
+ *
+ * \author ckielwein
+ */
+class mapped_file {
+public:
+	/// \throws std::system_error if the file cannot be opened or mapped
+	explicit mapped_file(const std::string& path) {
+		const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+		if (fd < 0)
+			throw std::system_error(errno, std::generic_category(), "mapped_file: cannot open " + path);
+		struct stat info;
+		if (::fstat(fd, &info) != 0) {
+			const auto error = errno;
+			::close(fd);
+			throw std::system_error(error, std::generic_category(), "mapped_file: cannot stat " + path);
+		}
+		size_ = static_cast<std::size_t>(info.st_size);
+		//mapping zero bytes is an error, an empty file is an empty view
+		if (size_ > 0) {
+			void* p = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+			if (p == MAP_FAILED) {
+				const auto error = errno;
+				::close(fd);
+				throw std::system_error(error, std::generic_category(), "mapped_file: cannot map " + path);
+			}
+			::madvise(p, size_, MADV_SEQUENTIAL);
+			data_ = static_cast<const char*>(p);
+		}
+		::close(fd);
+	}
+
+	mapped_file(mapped_file&& other) noexcept :
+			data_ { std::exchange(other.data_, nullptr) }, size_ { std::exchange(other.size_, 0) } {
+	}
+
+	mapped_file& operator=(mapped_file&& other) noexcept {
+		std::swap(data_, other.data_);
+		std::swap(size_, other.size_);
+		return *this;
+	}
+
+	~mapped_file() {
+		if (data_)
+			::munmap(const_cast<char*>(data_), size_);
+	}
+
+	const char* data() const noexcept {
+		return data_;
+	}
+
+	std::size_t size() const noexcept {
+		return size_;
+	}
+
+	std::string_view view() const noexcept {
+		return { data_, size_ };
+	}
+
+private:
+	const char* data_ = nullptr;
+	std::size_t size_ = 0;
+};
+
+/**
+ * \brief forward iterator over the records of a text, separated by a delimiter.
+ *
+ * Records do not contain the delimiter. Like std::getline,
+ * a trailing delimiter does not start another, empty record.
+ *
+ * \author ckielwein
+ */
+class record_iterator {
+public:
+	using iterator_category = std::forward_iterator_tag;
+	using value_type = std::string_view;
+	using difference_type = std::ptrdiff_t;
+	using pointer = const std::string_view*;
+	using reference = const std::string_view&;
+
+	record_iterator() noexcept = default;
+
+	/// iterator to the first record in [first, last)
+	record_iterator(const char* first, const char* end, char delim) noexcept :
+			next { first }, last { end }, delimiter { delim } {
+		advance();
+	}
+
+	reference operator*() const noexcept {
+		return record;
+	}
+
+	pointer operator->() const noexcept {
+		return &record;
+	}
+
+	record_iterator& operator++() noexcept {
+		advance();
+		return *this;
+	}
+
+	record_iterator operator++(int) noexcept {
+		auto old = *this;
+		advance();
+		return old;
+	}
+
+	friend bool operator==(const record_iterator& l, const record_iterator& r) noexcept {
+		return l.record.data() == r.record.data();
+	}
+
+	friend bool operator!=(const record_iterator& l, const record_iterator& r) noexcept {
+		return !(l == r);
+	}
+
+private:
+	void advance() noexcept {
+		if (next == last) {
+			//only the end iterator has a null record, empty records point into the text
+			record = { };
+			return;
+		}
+		const auto* found = static_cast<const char*>(std::memchr(next, delimiter, last - next));
+		const auto* record_end = found ? found : last;
+		record = { next, static_cast<std::size_t>(record_end - next) };
+		next = found ? found + 1 : last;
+	}
+
+	std::string_view record;
+	const char* next = nullptr;
+	const char* last = nullptr;
+	char delimiter = '\n';
+};
+
+/// lazy range of the records in \p text, separated by \p delimiter
+inline PairRange<record_iterator, record_iterator> records(std::string_view text, char delimiter) {
+	const auto* last = text.data() + text.size();
+	return { record_iterator { text.data(), last, delimiter }, record_iterator { last, last, delimiter } };
+}
+
+/// lazy range of the lines in \p text, without the '\\n'
+inline PairRange<record_iterator, record_iterator> lines(std::string_view text) {
+	return records(text, '\n');
+}
+
+/**
+ * \brief splits \p text in at most \p parts chunks of about equal size, which end after a delimiter.
+ *
+ * Every record is completely contained in one chunk, the chunks together are \p text.
+ * Chunks can be scanned with records() on different threads.
+ */
+inline std::vector<std::string_view> split_records(std::string_view text, std::size_t parts, char delimiter = '\n') {
+	std::vector<std::string_view> chunks;
+	const auto target = parts > 1 ? text.size() / parts : text.size();
+	while (!text.empty()) {
+		auto cut = chunks.size() + 1 < parts ? text.find(delimiter, target > 0 ? target - 1 : 0) : text.npos;
+		cut = cut == text.npos ? text.size() : cut + 1;
+		chunks.push_back(text.substr(0, cut));
+		text.remove_prefix(cut);
+	}
+	return chunks;
+}
+
+#endif /* BUBBLES_MAPPED_FILE_HPP_ */
@@ -0,0 +1,122 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Caspar Kielwein
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mapped_file.hpp"
+#include "benchmark.hpp"
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+/*
+ * Time per line of reading a log file with std::getline, fgets and mapped_file,
+ * also with the mapped file split over 4 threads.
+ * The log file is written to the temporary directory on first use.
+ */
+
+namespace {
+
+constexpr int thread_count = 4;
+
+struct log_file {
+	log_file() :
+			path((std::filesystem::temp_directory_path() / "bubbles_mapped_file_bench.log").string()) {
+		std::ofstream out { path };
+		for (int i = 0; i < 500000; ++i)
+			out << "2026-10-18T12:00:00." << i % 1000 << " INFO request " << i
+					<< " served in " << i % 97 << " ms from cache shard " << i % 16 << '\n';
+	}
+
+	~log_file() {
+		std::remove(path.c_str());
+	}
+
+	std::string path;
+};
+
+const std::string& log_path() {
+	static log_file file;
+	return file.path;
+}
+
+BENCHMARK("std::getline", [](std::size_t iterations) {
+	std::ifstream in { log_path() };
+	std::string line;
+	for (std::size_t i = 0; i < iterations; ++i) {
+		if (!std::getline(in, line)) {
+			in.clear();
+			in.seekg(0);
+			std::getline(in, line);
+		}
+		do_not_optimize(line);
+	}
+});
+
+BENCHMARK("fgets", [](std::size_t iterations) {
+	auto* in = std::fopen(log_path().c_str(), "r");
+	char line[256];
+	for (std::size_t i = 0; i < iterations; ++i) {
+		if (!std::fgets(line, sizeof(line), in)) {
+			std::rewind(in);
+			std::fgets(line, sizeof(line), in);
+		}
+		do_not_optimize(line);
+	}
+	std::fclose(in);
+});
+
+/// reads \p count lines from \p text, restarting at its beginning at the end
+void scan_lines(std::string_view text, std::size_t count) {
+	auto range = lines(text);
+	auto it = range.begin();
+	for (std::size_t i = 0; i < count; ++i) {
+		if (it == range.end())
+			it = range.begin();
+		do_not_optimize(*it);
+		++it;
+	}
+}
+
+BENCHMARK("mapped_file", [](std::size_t iterations) {
+	mapped_file file { log_path() };
+	scan_lines(file.view(), iterations);
+});
+
+BENCHMARK("mapped_file, split on 4 threads", [](std::size_t iterations) {
+	mapped_file file { log_path() };
+	std::vector<std::thread> threads;
+	for (auto chunk : split_records(file.view(), thread_count))
+		threads.emplace_back([=] { scan_lines(chunk, iterations / thread_count); });
+	for (auto& t : threads)
+		t.join();
+});
+
+} // namespace
@@ -0,0 +1,113 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Caspar Kielwein
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mapped_file.hpp"
+
+#include <cassert>
+#include <cstdio>
+#include <string>
+#include <system_error>
+#include <vector>
+
+std::vector<std::string_view> collect(std::string_view text, char delimiter = '\n') {
+	std::vector<std::string_view> result;
+	for (auto r : records(text, delimiter))
+		result.push_back(r);
+	return result;
+}
+
+int main() {
+	using v = std::vector<std::string_view>;
+	assert(collect("").empty());
+	assert((collect("a\nbb\n\nc") == v { "a", "bb", "", "c" }));
+	assert((collect("a\nbb\n") == v { "a", "bb" }));
+	assert((collect("\n") == v { "" }));
+	assert((collect("x;y;z", ';') == v { "x", "y", "z" }));
+
+	const std::string_view text = "first\nsecond\nthird\n";
+	const auto range = lines(text);
+	assert(range.size() == 3);
+	auto it = range.begin();
+	assert(it->size() == 5);
+	assert(*it++ == "first");
+	assert(*it == "second");
+	//records view the text, they are not copied
+	assert(it->data() == text.data() + 6);
+
+	//chunks end on record boundaries and cover the whole text
+	std::string big;
+	for (int i = 0; i < 1000; ++i)
+		big += std::to_string(i * 37) + "\n";
+	for (std::size_t parts : { 1, 2, 3, 7, 64, 5000 }) {
+		const auto chunks = split_records(big, parts);
+		assert(!chunks.empty());
+		assert(chunks.size() <= parts);
+		std::string joined;
+		std::size_t count = 0;
+		for (auto c : chunks) {
+			assert(c.back() == '\n');
+			joined += c;
+			count += lines(c).size();
+		}
+		assert(joined == big);
+		assert(count == 1000);
+	}
+	assert(split_records("", 4).empty());
+	assert((split_records("no delimiter", 4) == v { "no delimiter" }));
+
+	//mapping a file
+	const std::string path = "mapped_file_test.txt";
+	auto* f = std::fopen(path.c_str(), "w");
+	std::fputs("alpha\nbeta\ngamma", f);
+	std::fclose(f);
+	{
+		mapped_file file { path };
+		assert(file.size() == 16);
+		assert((collect(file.view()) == v { "alpha", "beta", "gamma" }));
+		auto moved = std::move(file);
+		assert(file.view().empty());
+		assert(moved.view().substr(0, 5) == "alpha");
+	}
+	f = std::fopen(path.c_str(), "w");
+	std::fclose(f);
+	{
+		mapped_file empty { path };
+		assert(empty.size() == 0);
+		assert(lines(empty.view()).size() == 0);
+	}
+	std::remove(path.c_str());
+
+	bool thrown = false;
+	try {
+		mapped_file missing { "does/not/exist" };
+	} catch (const std::system_error& e) {
+		thrown = true;
+		assert(e.code() == std::errc::no_such_file_or_directory);
+	}
+	assert(thrown);
+}
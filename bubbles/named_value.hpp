@@ -29,6 +29,9 @@
 #ifndef BUBBLES_NAMED_VALUE_HPP_
 #define BUBBLES_NAMED_VALUE_HPP_
 
+#include <cstddef>
+#include <functional>
+#include <type_traits>
 #include <utility>
 
 /**
@@ -52,6 +55,13 @@
  * with height and width swapped.
  *
  * operator== and operator< are provided for convenience and storage in std::set.
+ * The remaining comparison operators are derived from them.
+ * Arithmetic is opt-in, see named_value_arithmetic.hpp.
+ * std::hash is specialized for storage in std::unordered_set.
+ *
+ * NamedValue is constexpr and adds no overhead, get() returns a reference.
+ * NamedValue of a trivially copyable type stays trivially copyable and standard layout,
+ * so containers of NamedValue can still use memcpy and be vectorized.
  *
  * A nice side note is, that using the NamedValue actually allows
  * compiler optimizations, when passing Values by reference, as the compiler
@@ -65,35 +75,101 @@
 template<class T, class tag>
 class NamedValue {
 public:
+	using value_type = T;
+	using tag_type = tag;
+
 	/// Require explicit conversion from original value
-	explicit NamedValue(T v) :
+	constexpr explicit NamedValue(T v) noexcept(std::is_nothrow_move_constructible<T>::value) :
 			value { std::move(v) } {
 	}
 
 	NamedValue() = default;
 
 	/// Require explicit conversion to original value
-	explicit operator T() const {
+	constexpr explicit operator T() const& noexcept(std::is_nothrow_copy_constructible<T>::value) {
 		return value;
 	}
 
-	/// short call to get original value
-	T get() const {
+	/// Require explicit conversion to original value, moves the value out of temporaries
+	constexpr explicit operator T() && noexcept(std::is_nothrow_move_constructible<T>::value) {
+		return std::move(value);
+	}
+
+	/// short call to get original value, does not copy it
+	constexpr const T& get() const& noexcept {
 		return value;
 	}
 
+	/// moves the original value out of temporaries
+	constexpr T&& get() && noexcept {
+		return std::move(value);
+	}
+
 private:
 	T value;
 };
 
 template<class T, class tag>
-bool operator==(const NamedValue<T,tag>& l, const NamedValue<T,tag>& r) {
+constexpr bool operator==(const NamedValue<T,tag>& l, const NamedValue<T,tag>& r)
+		noexcept(noexcept(l.get() == r.get())) {
 	return l.get() == r.get();
 }
 
 template<class T, class tag>
-bool operator<(const NamedValue<T,tag>& l, const NamedValue<T,tag>& r) {
+constexpr bool operator<(const NamedValue<T,tag>& l, const NamedValue<T,tag>& r)
+		noexcept(noexcept(l.get() < r.get())) {
 	return l.get() < r.get();
 }
 
+template<class T, class tag>
+constexpr bool operator!=(const NamedValue<T,tag>& l, const NamedValue<T,tag>& r)
+		noexcept(noexcept(l == r)) {
+	return !(l == r);
+}
+
+template<class T, class tag>
+constexpr bool operator>(const NamedValue<T,tag>& l, const NamedValue<T,tag>& r)
+		noexcept(noexcept(r < l)) {
+	return r < l;
+}
+
+template<class T, class tag>
+constexpr bool operator<=(const NamedValue<T,tag>& l, const NamedValue<T,tag>& r)
+		noexcept(noexcept(r < l)) {
+	return !(r < l);
+}
+
+template<class T, class tag>
+constexpr bool operator>=(const NamedValue<T,tag>& l, const NamedValue<T,tag>& r)
+		noexcept(noexcept(l < r)) {
+	return !(l < r);
+}
+
+namespace std {
+
+/// NamedValue hashes just like the wrapped value, to allow storage in std::unordered_set
+template<class T, class tag>
+struct hash<NamedValue<T, tag>> {
+	std::size_t operator()(const NamedValue<T, tag>& v) const
+			noexcept(noexcept(std::hash<T> { }(v.get()))) {
+		return std::hash<T> { }(v.get());
+	}
+};
+
+} // namespace std
+
+namespace detail {
+struct named_value_layout_tag {
+};
+using named_double = NamedValue<double, named_value_layout_tag>;
+} // namespace detail
+
+//NamedValue of trivial types must not add any overhead, containers rely on this for memcpy and vectorization
+static_assert(std::is_trivially_copyable<detail::named_double>::value,
+		"NamedValue of a trivially copyable type needs to be trivially copyable");
+static_assert(std::is_standard_layout<detail::named_double>::value,
+		"NamedValue of a standard layout type needs to be standard layout");
+static_assert(sizeof(detail::named_double) == sizeof(double),
+		"NamedValue must not add any storage");
+
 #endif /* BUBBLES_NAMED_VALUE_HPP_ */
@@ -0,0 +1,196 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Caspar Kielwein
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef BUBBLES_NAMED_VALUE_ARITHMETIC_HPP_
+#define BUBBLES_NAMED_VALUE_ARITHMETIC_HPP_
+
+#include "named_value.hpp"
+
+#include <cstdint>
+#include <ratio>
+#include <type_traits>
+
+/*
+ * Opt-in arithmetic and compile time units for NamedValue.
+ *
+ * A NamedValue supports no arithmetic by default.
+ * Tags opt in by deriving from the following marker types:
+ * * named_additive: addition and subtraction of equal NamedValues
+ * * named_scalable: multiplication and division with the underlying value type,
+ *   division of two equal NamedValues returns their ratio.
+ * * named_unit<Dimension, Ratio>: named_cast converts between all NamedValues
+ *   of the same Dimension, like std::chrono::duration_cast.
+ *
+ * ~~~{.cpp}
+ * struct time {};
+ * struct ms_tag : named_additive, named_unit<time, std::milli> {};
+ * struct ns_tag : named_additive, named_unit<time, std::nano> {};
+ * using Milliseconds = NamedValue<long, ms_tag>;
+ * using Nanoseconds = NamedValue<long, ns_tag>;
+ *
+ * Nanoseconds ns = named_cast<Nanoseconds>(Milliseconds{3} + Milliseconds{2});
+ * ~~~
+ * The conversion factor is a compile time constant,
+ * the generated code is identical to raw arithmetic with the factor written out.
+ * Arithmetic between different tags, or casts between different dimensions, don't compile.
+ *
+ * Instead of deriving from the markers, named_value_traits can be specialized for a tag.
+ *
+ * \author ckielwein
+ */
+
+/// marker for tags of NamedValues, which can be added and subtracted
+struct named_additive {
+};
+
+/// marker for tags of NamedValues, which can be multiplied with and divided by scalars
+struct named_scalable {
+};
+
+/**
+ * \brief marker for tags of NamedValues, which represent a unit
+ * \tparam Dimension type describing the dimension, only equal dimensions can be converted
+ * \tparam Ratio std::ratio of the unit to the base unit of the dimension
+ */
+template<class Dimension, class Ratio = std::ratio<1>>
+struct named_unit {
+	using dimension = Dimension;
+	using ratio = Ratio;
+};
+
+namespace detail {
+
+template<class tag, class = void>
+struct unit_of {
+	using dimension = void;
+	using ratio = std::ratio<1>;
+	static constexpr bool is_unit = false;
+};
+
+template<class tag>
+struct unit_of<tag, std::enable_if_t<std::is_base_of<named_unit<typename tag::dimension, typename tag::ratio>, tag>::value>> {
+	using dimension = typename tag::dimension;
+	using ratio = typename tag::ratio;
+	static constexpr bool is_unit = true;
+};
+
+} // namespace detail
+
+/// describes which operations a NamedValue with \p tag supports, may be specialized.
+template<class tag>
+struct named_value_traits {
+	static constexpr bool additive = std::is_base_of<named_additive, tag>::value;
+	static constexpr bool scalable = std::is_base_of<named_scalable, tag>::value;
+	static constexpr bool unit = detail::unit_of<tag>::is_unit;
+	using dimension = typename detail::unit_of<tag>::dimension;
+	using ratio = typename detail::unit_of<tag>::ratio;
+};
+
+namespace detail {
+
+template<class tag>
+using enable_additive = std::enable_if_t<named_value_traits<tag>::additive>;
+
+template<class tag>
+using enable_scalable = std::enable_if_t<named_value_traits<tag>::scalable>;
+
+} // namespace detail
+
+template<class T, class tag, class = detail::enable_additive<tag>>
+constexpr NamedValue<T, tag> operator+(const NamedValue<T, tag>& l, const NamedValue<T, tag>& r) {
+	return NamedValue<T, tag> { l.get() + r.get() };
+}
+
+template<class T, class tag, class = detail::enable_additive<tag>>
+constexpr NamedValue<T, tag> operator-(const NamedValue<T, tag>& l, const NamedValue<T, tag>& r) {
+	return NamedValue<T, tag> { l.get() - r.get() };
+}
+
+template<class T, class tag, class = detail::enable_additive<tag>>
+constexpr NamedValue<T, tag> operator-(const NamedValue<T, tag>& v) {
+	return NamedValue<T, tag> { -v.get() };
+}
+
+template<class T, class tag, class = detail::enable_additive<tag>>
+constexpr NamedValue<T, tag>& operator+=(NamedValue<T, tag>& l, const NamedValue<T, tag>& r) {
+	return l = l + r;
+}
+
+template<class T, class tag, class = detail::enable_additive<tag>>
+constexpr NamedValue<T, tag>& operator-=(NamedValue<T, tag>& l, const NamedValue<T, tag>& r) {
+	return l = l - r;
+}
+
+template<class T, class tag, class = detail::enable_scalable<tag>>
+constexpr NamedValue<T, tag> operator*(const NamedValue<T, tag>& v, const typename NamedValue<T, tag>::value_type& factor) {
+	return NamedValue<T, tag> { v.get() * factor };
+}
+
+template<class T, class tag, class = detail::enable_scalable<tag>>
+constexpr NamedValue<T, tag> operator*(const typename NamedValue<T, tag>::value_type& factor, const NamedValue<T, tag>& v) {
+	return NamedValue<T, tag> { factor * v.get() };
+}
+
+template<class T, class tag, class = detail::enable_scalable<tag>>
+constexpr NamedValue<T, tag> operator/(const NamedValue<T, tag>& v, const typename NamedValue<T, tag>::value_type& divisor) {
+	return NamedValue<T, tag> { v.get() / divisor };
+}
+
+/// the ratio of two equal NamedValues is a plain value
+template<class T, class tag, class = detail::enable_scalable<tag>>
+constexpr T operator/(const NamedValue<T, tag>& l, const NamedValue<T, tag>& r) {
+	return l.get() / r.get();
+}
+
+/**
+ * \brief converts between NamedValues of the same dimension
+ * \tparam To target NamedValue
+ * \param from value to convert
+ * \return from converted to the unit of To
+ *
+ * The conversion factor is computed at compile time, just like std::chrono::duration_cast.
+ * Conversions to coarser units with integral values truncate.
+ */
+template<class To, class T, class tag>
+constexpr To named_cast(const NamedValue<T, tag>& from) {
+	using from_traits = named_value_traits<tag>;
+	using to_traits = named_value_traits<typename To::tag_type>;
+	static_assert(from_traits::unit && to_traits::unit,
+			"named_cast requires both NamedValues to be units");
+	static_assert(std::is_same<typename from_traits::dimension, typename to_traits::dimension>::value,
+			"named_cast requires units of the same dimension");
+
+	using factor = std::ratio_divide<typename from_traits::ratio, typename to_traits::ratio>;
+	using To_T = typename To::value_type;
+	using common = std::common_type_t<T, To_T, std::intmax_t>;
+
+	return To { static_cast<To_T>(static_cast<common>(from.get())
+			* static_cast<common>(factor::num) / static_cast<common>(factor::den)) };
+}
+
+#endif /* BUBBLES_NAMED_VALUE_ARITHMETIC_HPP_ */
@@ -0,0 +1,66 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Caspar Kielwein
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "named_value_arithmetic.hpp"
+#include "benchmark.hpp"
+
+#include <cstdint>
+#include <ratio>
+#include <vector>
+
+/*
+ * Compares conversions with named_cast to raw arithmetic with the factor written out.
+ */
+
+namespace {
+
+struct time_dimension {};
+struct ms_tag : named_additive, named_unit<time_dimension, std::milli> {};
+struct ns_tag : named_additive, named_unit<time_dimension, std::nano> {};
+
+using Milliseconds = NamedValue<std::int64_t, ms_tag>;
+using Nanoseconds = NamedValue<std::int64_t, ns_tag>;
+
+std::vector<std::int64_t> raw(1 << 12, 3);
+std::vector<Milliseconds> named(1 << 12, Milliseconds { 3 });
+
+BENCHMARK("sum of ms in ns, raw", [] {
+	std::int64_t sum = 0;
+	for (auto ms : raw)
+		sum += ms * 1000000;
+	do_not_optimize(sum);
+});
+
+BENCHMARK("sum of ms in ns, named_cast", [] {
+	Nanoseconds sum { 0 };
+	for (auto ms : named)
+		sum += named_cast<Nanoseconds>(ms);
+	do_not_optimize(sum);
+});
+
+} // namespace
@@ -0,0 +1,118 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Caspar Kielwein
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "named_value_arithmetic.hpp"
+
+#include <cassert>
+#include <cstdint>
+#include <ratio>
+#include <type_traits>
+#include <utility>
+
+struct time_dimension {};
+struct memory_dimension {};
+
+struct ms_tag : named_additive, named_scalable, named_unit<time_dimension, std::milli> {};
+struct ns_tag : named_additive, named_scalable, named_unit<time_dimension, std::nano> {};
+struct bytes_tag : named_additive, named_unit<memory_dimension> {};
+struct pages_tag : named_additive, named_unit<memory_dimension, std::ratio<4096>> {};
+struct plain_tag {};
+
+using Milliseconds = NamedValue<std::int64_t, ms_tag>;
+using Nanoseconds = NamedValue<std::int64_t, ns_tag>;
+using Bytes = NamedValue<std::uint64_t, bytes_tag>;
+using Pages = NamedValue<std::uint64_t, pages_tag>;
+using Plain = NamedValue<int, plain_tag>;
+
+template<class L, class R, class = void>
+struct can_add : std::false_type {};
+template<class L, class R>
+struct can_add<L, R, decltype(void(std::declval<L>() + std::declval<R>()))> : std::true_type {};
+
+template<class L, class R, class = void>
+struct can_multiply : std::false_type {};
+template<class L, class R>
+struct can_multiply<L, R, decltype(void(std::declval<L>() * std::declval<R>()))> : std::true_type {};
+
+template<class To, class From, class = void>
+struct can_cast : std::false_type {};
+template<class To, class From>
+struct can_cast<To, From, decltype(void(named_cast<To>(std::declval<From>())))> : std::true_type {};
+
+//arithmetic is only available if the tag opts in, and never between different tags
+static_assert(can_add<Milliseconds, Milliseconds>::value, "additive tag");
+static_assert(!can_add<Milliseconds, Nanoseconds>::value, "different tags must not mix");
+static_assert(!can_add<Milliseconds, std::int64_t>::value, "raw values must not mix");
+static_assert(!can_add<Plain, Plain>::value, "arithmetic is opt-in");
+static_assert(can_multiply<Milliseconds, std::int64_t>::value, "scalable tag");
+static_assert(!can_multiply<Milliseconds, Milliseconds>::value, "products change the unit");
+static_assert(!can_multiply<Bytes, std::uint64_t>::value, "bytes are not scalable");
+
+//casts only work within one dimension
+static_assert(can_cast<Nanoseconds, Milliseconds>::value, "same dimension");
+static_assert(can_cast<Bytes, Pages>::value, "same dimension");
+//named_cast<Bytes>(Milliseconds { 1 }) fails with a static_assert, which can't be tested here
+
+//conversions are evaluated at compile time, the factor is a constant
+static_assert(named_cast<Nanoseconds>(Milliseconds { 3 }).get() == 3000000, "ms to ns");
+static_assert(named_cast<Milliseconds>(Nanoseconds { 3999999 }).get() == 3, "ns to ms truncates");
+static_assert(named_cast<Bytes>(Pages { 2 }).get() == 8192, "pages to bytes");
+static_assert(named_cast<Pages>(Bytes { 8192 }).get() == 2, "bytes to pages");
+static_assert((Milliseconds { 2 } + Milliseconds { 3 }).get() == 5, "constexpr addition");
+static_assert((Milliseconds { 4 } * 2 / 4).get() == 2, "constexpr scaling");
+
+/*
+ * hand written reference for the generated code of named_cast.
+ * With optimization both functions compile to a single multiplication, check with
+ * g++ -std=c++14 -O2 -S named_value_arithmetic_test.cpp
+ */
+std::int64_t raw_ms_to_ns(std::int64_t ms) {
+	return ms * 1000000;
+}
+
+std::int64_t named_ms_to_ns(Milliseconds ms) {
+	return named_cast<Nanoseconds>(ms).get();
+}
+
+int main() {
+	Milliseconds a { 10 };
+	a += Milliseconds { 5 };
+	assert(a == Milliseconds { 15 });
+	a -= Milliseconds { 20 };
+	assert(a == Milliseconds { -5 });
+	assert(-a == Milliseconds { 5 });
+	assert(a < Milliseconds { 0 });
+	assert(a != Milliseconds { 0 });
+	assert(Milliseconds { 10 } / Milliseconds { 5 } == 2);
+	assert(2 * Milliseconds { 10 } == Milliseconds { 20 });
+
+	for (std::int64_t ms = -1000; ms < 1000; ++ms)
+		assert(named_ms_to_ns(Milliseconds { ms }) == raw_ms_to_ns(ms));
+
+	return 0;
+}
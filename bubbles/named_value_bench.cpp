@@ -0,0 +1,96 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Caspar Kielwein
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "named_value.hpp"
+#include "benchmark.hpp"
+
+#include <vector>
+
+/*
+ * Compares loops over std::vector<double> with loops over std::vector<NamedValue<double>>.
+ *
+ * Both versions vectorize the same way, check with
+ * g++ -std=c++14 -O3 -fopt-info-vec named_value_bench.cpp
+ * The sums are only vectorized with -ffast-math, since they reorder floating point additions,
+ * this is again the same for both versions.
+ */
+
+namespace {
+
+struct height_tag {};
+using Height = NamedValue<double, height_tag>;
+
+BENCHMARK_NOINLINE double sum_raw(const std::vector<double>& v) {
+	double sum = 0;
+	for (auto x : v)
+		sum += x;
+	return sum;
+}
+
+BENCHMARK_NOINLINE double sum_named(const std::vector<Height>& v) {
+	double sum = 0;
+	for (const auto& x : v)
+		sum += x.get();
+	return sum;
+}
+
+BENCHMARK_NOINLINE void scale_raw(std::vector<double>& v, double factor) {
+	for (auto& x : v)
+		x = x * factor;
+}
+
+BENCHMARK_NOINLINE void scale_named(std::vector<Height>& v, double factor) {
+	for (auto& x : v)
+		x = Height { x.get() * factor };
+}
+
+constexpr std::size_t count = 1 << 14;
+std::vector<double> raw(count, 1.0);
+std::vector<Height> named(count, Height { 1.0 });
+
+BENCHMARK("sum std::vector<double>", [] {
+	do_not_optimize(sum_raw(raw));
+	clobber_memory();
+});
+
+BENCHMARK("sum std::vector<NamedValue<double>>", [] {
+	do_not_optimize(sum_named(named));
+	clobber_memory();
+});
+
+BENCHMARK("scale std::vector<double>", [] {
+	scale_raw(raw, 1.0000001);
+	clobber_memory();
+});
+
+BENCHMARK("scale std::vector<NamedValue<double>>", [] {
+	scale_named(named, 1.0000001);
+	clobber_memory();
+});
+
+} // namespace
@@ -29,6 +29,10 @@
 #include "named_value.hpp"
 
 #include <cassert>
+#include <string>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
 
 struct unique_tag {};
 
@@ -46,6 +50,25 @@ struct foo {
 
 using FooValue = NamedValue<foo, unique_tag>;
 
+struct name_tag {};
+using Name = NamedValue<std::string, name_tag>;
+
+struct height_tag {};
+using Height = NamedValue<double, height_tag>;
+
+static_assert(std::is_trivially_copyable<Height>::value, "NamedValue<double> must be trivially copyable");
+static_assert(std::is_trivially_default_constructible<Height>::value, "NamedValue<double> must be trivial");
+static_assert(std::is_standard_layout<Height>::value, "NamedValue<double> must be standard layout");
+static_assert(sizeof(Height) == sizeof(double), "NamedValue<double> must not add storage");
+static_assert(std::is_nothrow_copy_constructible<Height>::value, "NamedValue<double> copies can't throw");
+static_assert(std::is_nothrow_move_constructible<Name>::value, "NamedValue<std::string> moves can't throw");
+
+//NamedValue is usable at compile time
+constexpr Height max_height { 2.5 };
+static_assert(max_height.get() == 2.5, "constexpr get");
+static_assert(Height { 1.0 } < max_height, "constexpr operator<");
+static_assert(static_cast<double>(max_height) == 2.5, "constexpr conversion");
+
 int main() {
 
 	assert(getVal(IntValue { 1 }) == 1);
@@ -60,5 +83,24 @@ int main() {
 	//show that we can use types without default constructor
 	FooValue foo_v { 0 };
 
+	//get returns a reference, no copy is made
+	const Name name { "a rather long name, which does not fit in the small string buffer" };
+	assert(&name.get() == &name.get());
+
+	//values can be moved out of temporaries
+	Name temporary { "moved" };
+	std::string moved = std::move(temporary).get();
+	assert(moved == "moved");
+
+	std::unordered_set<Name> names;
+	names.insert(name);
+	names.insert(Name { "other" });
+	assert(names.count(name) == 1);
+	assert(std::hash<Name> { }(name) == std::hash<std::string> { }(name.get()));
+
+	std::vector<Height> heights(3, Height { 1.5 });
+	auto copy = heights;
+	assert(copy[2] == Height { 1.5 });
+
 	return 0;
 }
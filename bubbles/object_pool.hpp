@@ -0,0 +1,294 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Caspar Kielwein
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef BUBBLES_OBJECT_POOL_HPP_
+#define BUBBLES_OBJECT_POOL_HPP_
+
+#include "thread_index.hpp"
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+/**
+ * \brief pool of reusable objects with a free list per thread.
+ *
+ * object_pool keeps objects which are expensive to construct, like parsers or buffers,
+ * and hands them out again instead of constructing new ones.
+ * Borrowed objects are returned automatically, when their handle is destroyed,
+ * just like scope_exit executes its callback.
+ *
+ * Every thread has its own free list, acquiring and releasing on the same thread
+ * takes no locks and no atomic read-modify-write.
+ * Objects released on another thread are pushed to a lock-free return stack
+ * of the thread which acquired them. That thread takes all returned objects at once,
+ * when its own free list runs empty.
+ *
+ * Objects created by reserve() are kept in a shared depot, from which any thread takes
+ * objects in batches, when it runs out.
+ *
+ * ~~~{.cpp}
+ * object_pool<parser> parsers { [](parser& p) { p.reset(); } };
+ * parsers.reserve(64); //pre-warm
+ * {
+ *     auto p = parsers.acquire();
+ *     p->parse(input);
+ * } //p returns to the pool
+ * ~~~
+ *
+ * The pool needs to outlive all handles.
+ *
+ * \tparam T pooled type, needs to be default constructible
+ * \author ckielwein
+ */
+template<class T>
+class object_pool {
+	struct shard;
+
+	struct node {
+		T value;
+		node* next = nullptr;
+		shard* owner = nullptr;
+	};
+
+	/// free lists of a single thread, padded to its own cache lines
+	struct alignas(64) shard {
+		node* local = nullptr; //only accessed by the owning thread
+		std::atomic<node*> returned { nullptr }; //pushed by all other threads
+		std::size_t index = 0;
+	};
+
+public:
+	/// borrowed object, returns it to the pool on destruction
+	class handle {
+	public:
+		handle() noexcept = default;
+
+		handle(handle&& other) noexcept :
+				pool(other.pool), n(other.n) {
+			other.n = nullptr;
+		}
+
+		handle& operator=(handle&& other) noexcept {
+			if (this != &other) {
+				reset();
+				pool = other.pool;
+				n = other.n;
+				other.n = nullptr;
+			}
+			return *this;
+		}
+
+		handle(const handle&) = delete;
+		handle& operator=(const handle&) = delete;
+
+		~handle() {
+			reset();
+		}
+
+		/// returns the object to the pool early
+		void reset() noexcept {
+			if (n)
+				pool->release(n);
+			n = nullptr;
+		}
+
+		T& operator*() const noexcept {
+			return n->value;
+		}
+		T* operator->() const noexcept {
+			return &n->value;
+		}
+		T* get() const noexcept {
+			return n ? &n->value : nullptr;
+		}
+		explicit operator bool() const noexcept {
+			return n != nullptr;
+		}
+
+	private:
+		friend class object_pool;
+		handle(object_pool* pool, node* n) noexcept :
+				pool(pool), n(n) {
+		}
+
+		object_pool* pool = nullptr;
+		node* n = nullptr;
+	};
+
+	/**
+	 * \param reset called on every object before it returns to the pool
+	 * \param max_objects high-water mark, objects beyond it are deleted on release instead of kept
+	 * \param max_threads number of threads with their own free list, additional threads use the depot
+	 */
+	explicit object_pool(std::function<void(T&)> reset = { },
+			std::size_t max_objects = std::numeric_limits<std::size_t>::max(), std::size_t max_threads = 64) :
+			reset_object(std::move(reset)), max_objects(max_objects), shards(max_threads) {
+		for (std::size_t i = 0; i < shards.size(); ++i)
+			shards[i].index = i;
+	}
+
+	object_pool(const object_pool&) = delete;
+	object_pool& operator=(const object_pool&) = delete;
+
+	/// deletes all pooled objects, no object may be borrowed any more
+	~object_pool() {
+#ifndef NDEBUG
+		assert(borrowed.load() == 0 && "object_pool destroyed while objects are borrowed");
+#endif
+		for (auto& s : shards) {
+			delete_list(s.local);
+			delete_list(s.returned.load(std::memory_order_acquire));
+		}
+		delete_list(depot);
+	}
+
+	/// pre-warms the pool with \p count new objects, the high-water mark still applies
+	void reserve(std::size_t count) {
+		std::lock_guard<std::mutex> lock { depot_mutex };
+		for (std::size_t i = 0; i < count && created.load(std::memory_order_relaxed) < max_objects; ++i) {
+			auto* n = create();
+			n->next = depot;
+			depot = n;
+		}
+	}
+
+	/// borrows an object from the pool, constructs a new one if the pool is empty
+	handle acquire() {
+		auto* s = own_shard();
+		node* n = s ? pop(*s) : nullptr;
+		if (!n)
+			n = take_from_depot(s);
+		if (!n)
+			n = create();
+		n->owner = s;
+#ifndef NDEBUG
+		borrowed.fetch_add(1, std::memory_order_relaxed);
+#endif
+		return handle { this, n };
+	}
+
+	/// number of objects constructed by the pool and not yet deleted
+	std::size_t size() const noexcept {
+		return created.load(std::memory_order_relaxed);
+	}
+
+private:
+	shard* own_shard() {
+		const auto index = thread_index();
+		return index < shards.size() ? &shards[index] : nullptr;
+	}
+
+	node* pop(shard& s) {
+		if (!s.local)
+			s.local = s.returned.exchange(nullptr, std::memory_order_acquire);
+		auto* n = s.local;
+		if (n)
+			s.local = n->next;
+		return n;
+	}
+
+	/// takes a batch of objects from the depot, one is returned, the rest goes to \p s
+	node* take_from_depot(shard* s) {
+		constexpr int batch = 16;
+		std::lock_guard<std::mutex> lock { depot_mutex };
+		auto* n = depot;
+		if (!n)
+			return nullptr;
+		depot = n->next;
+		for (int i = 1; s && depot && i < batch; ++i) {
+			auto* moved = depot;
+			depot = moved->next;
+			moved->next = s->local;
+			s->local = moved;
+		}
+		return n;
+	}
+
+	node* create() {
+		auto* n = new node { };
+		created.fetch_add(1, std::memory_order_relaxed);
+		return n;
+	}
+
+	void release(node* n) noexcept {
+#ifndef NDEBUG
+		borrowed.fetch_sub(1, std::memory_order_relaxed);
+#endif
+		auto count = created.load(std::memory_order_relaxed);
+		while (count > max_objects) {
+			if (created.compare_exchange_weak(count, count - 1, std::memory_order_relaxed)) {
+				delete n;
+				return;
+			}
+		}
+		if (reset_object)
+			reset_object(n->value);
+
+		auto* s = n->owner;
+		if (!s) {
+			std::lock_guard<std::mutex> lock { depot_mutex };
+			n->next = depot;
+			depot = n;
+		} else if (s == own_shard()) {
+			n->next = s->local;
+			s->local = n;
+		} else {
+			n->next = s->returned.load(std::memory_order_relaxed);
+			while (!s->returned.compare_exchange_weak(n->next, n, std::memory_order_release,
+					std::memory_order_relaxed)) {
+			}
+		}
+	}
+
+	static void delete_list(node* n) {
+		while (n) {
+			auto* next = n->next;
+			delete n;
+			n = next;
+		}
+	}
+
+	std::function<void(T&)> reset_object;
+	const std::size_t max_objects;
+	std::vector<shard> shards;
+
+	std::mutex depot_mutex;
+	node* depot = nullptr;
+
+	std::atomic<std::size_t> created { 0 };
+	//only counted without NDEBUG to detect leaked handles, but always present to keep the layout the same
+	std::atomic<std::size_t> borrowed { 0 };
+};
+
+#endif /* BUBBLES_OBJECT_POOL_HPP_ */
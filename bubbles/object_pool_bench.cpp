@@ -0,0 +1,124 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Caspar Kielwein
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "object_pool.hpp"
+#include "benchmark.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/*
+ * Acquire and release latency of object_pool compared to new/delete and std::make_unique,
+ * on a single thread, and with a producer thread handing objects to a consumer thread.
+ */
+
+namespace {
+
+/// request context, which allocates some buffers on construction
+struct context {
+	context() {
+		buffer.reserve(4096);
+		headers.reserve(32);
+	}
+	void reset() {
+		buffer.clear();
+		headers.clear();
+	}
+
+	std::string buffer;
+	std::vector<std::pair<int, int>> headers;
+};
+
+object_pool<context> pool { [](context& c) { c.reset(); } };
+
+BENCHMARK("new/delete", [] {
+	auto* c = new context;
+	do_not_optimize(c);
+	delete c;
+});
+
+BENCHMARK("std::make_unique", [] {
+	auto c = std::make_unique<context>();
+	do_not_optimize(c);
+});
+
+BENCHMARK("object_pool", [] {
+	auto c = pool.acquire();
+	do_not_optimize(c);
+});
+
+/// hands objects from a producer to a consumer thread, which releases them
+template<class Pointer, class Make>
+void producer_consumer(std::size_t iterations, Make make) {
+	std::mutex mutex;
+	std::condition_variable ready;
+	std::deque<Pointer> queue;
+	bool done = false;
+
+	std::thread consumer { [&] {
+		std::deque<Pointer> taken;
+		while (true) {
+			{
+				std::unique_lock<std::mutex> lock { mutex };
+				ready.wait(lock, [&] { return !queue.empty() || done; });
+				if (queue.empty() && done)
+					return;
+				taken.swap(queue);
+			}
+			taken.clear();
+		}
+	} };
+
+	for (std::size_t i = 0; i < iterations; ++i) {
+		auto p = make();
+		std::lock_guard<std::mutex> lock { mutex };
+		queue.push_back(std::move(p));
+		ready.notify_one();
+	}
+	{
+		std::lock_guard<std::mutex> lock { mutex };
+		done = true;
+	}
+	ready.notify_one();
+	consumer.join();
+}
+
+BENCHMARK("producer/consumer std::make_unique", [](std::size_t iterations) {
+	producer_consumer<std::unique_ptr<context>>(iterations, [] { return std::make_unique<context>(); });
+});
+
+BENCHMARK("producer/consumer object_pool", [](std::size_t iterations) {
+	producer_consumer<object_pool<context>::handle>(iterations, [] { return pool.acquire(); });
+});
+
+} // namespace
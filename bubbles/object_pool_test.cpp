@@ -0,0 +1,147 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Caspar Kielwein
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "object_pool.hpp"
+
+#include <atomic>
+#include <cassert>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct buffer {
+	static std::atomic<int> constructed;
+
+	buffer() {
+		++constructed;
+	}
+
+	std::string data;
+};
+
+std::atomic<int> buffer::constructed { 0 };
+
+int main() {
+	object_pool<buffer> pool { [](buffer& b) { b.data.clear(); } };
+
+	const buffer* first;
+	{
+		auto b = pool.acquire();
+		assert(b);
+		b->data = "used";
+		first = b.get();
+	}
+	assert(buffer::constructed == 1);
+
+	//the same object is handed out again, after it was reset
+	{
+		auto b = pool.acquire();
+		assert(b.get() == first);
+		assert(b->data.empty());
+		auto moved = std::move(b);
+		assert(!b);
+		assert(moved.get() == first);
+	}
+	assert(buffer::constructed == 1);
+
+	//pre-warming constructs objects up front
+	pool.reserve(10);
+	assert(buffer::constructed == 11);
+	assert(pool.size() == 11);
+	{
+		std::vector<object_pool<buffer>::handle> handles;
+		for (int i = 0; i < 11; ++i)
+			handles.push_back(pool.acquire());
+		assert(buffer::constructed == 11);
+		handles.push_back(pool.acquire());
+		assert(buffer::constructed == 12);
+	}
+
+	//objects beyond the high-water mark are deleted on release
+	object_pool<buffer> limited { { }, 2 };
+	{
+		auto a = limited.acquire();
+		auto b = limited.acquire();
+		auto c = limited.acquire();
+		assert(limited.size() == 3);
+	}
+	assert(limited.size() == 2);
+
+	//concurrent releases never shrink the pool below the high-water mark
+	{
+		std::vector<object_pool<buffer>::handle> handles;
+		for (int i = 0; i < 400; ++i)
+			handles.push_back(limited.acquire());
+		std::vector<std::thread> releasers;
+		for (int t = 0; t < 4; ++t)
+			releasers.emplace_back([&handles, t] {
+				for (int i = t; i < 400; i += 4)
+					handles[i] = { };
+			});
+		for (auto& r : releasers)
+			r.join();
+	}
+	assert(limited.size() == 2);
+
+	//objects acquired on one thread, released on another
+	constexpr int count = 1000;
+	const auto size_before = pool.size();
+	std::mutex mutex;
+	std::vector<object_pool<buffer>::handle> queue;
+	std::atomic<int> released { 0 };
+	std::thread consumer { [&] {
+		while (released != count) {
+			std::vector<object_pool<buffer>::handle> taken;
+			{
+				std::lock_guard<std::mutex> lock { mutex };
+				taken.swap(queue);
+			}
+			const auto n = static_cast<int>(taken.size());
+			taken.clear(); //handles are released on the consumer thread
+			released += n;
+			std::this_thread::yield();
+		}
+	} };
+	for (int i = 0; i < count; ++i) {
+		auto b = pool.acquire();
+		b->data = "message";
+		{
+			std::lock_guard<std::mutex> lock { mutex };
+			queue.push_back(std::move(b));
+		}
+		while (released != i + 1)
+			std::this_thread::yield();
+	}
+	consumer.join();
+
+	//returned objects are reused instead of creating new ones for every message
+	assert(pool.size() == size_before);
+
+	return 0;
+}
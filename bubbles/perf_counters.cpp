@@ -0,0 +1,237 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Caspar Kielwein
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "perf_counters.hpp"
+#include "bubble_inline.hpp"
+#include "prettyprint.hpp"
+
+BUBBLE_INLINE perf_sample operator-(const perf_sample& later, const perf_sample& earlier) {
+	perf_sample result;
+	result.time = later.time - earlier.time;
+	for (std::size_t i = 0; i < perf_event_count; ++i)
+		result.counts[i] = later.counts[i] - earlier.counts[i];
+	return result;
+}
+
+BUBBLE_INLINE const char* perf_event_name(perf_event e) {
+	switch (e) {
+	case perf_event::cycles:
+		return "cycles";
+	case perf_event::instructions:
+		return "instructions";
+	case perf_event::cache_misses:
+		return "cache_misses";
+	case perf_event::branch_misses:
+		return "branch_misses";
+	}
+	return "unknown";
+}
+
+BUBBLE_INLINE perf_region::perf_region(const char* name, const perf_counter_group& counters) :
+		name(name), counters(counters), start(counters.read()) {
+}
+
+BUBBLE_INLINE perf_region::~perf_region() {
+	if (!active)
+		return;
+	const auto d = elapsed();
+	if (counters.available())
+		print(name, "time_ns", d.time.count(),
+				perf_event_name(perf_event::cycles), d[perf_event::cycles],
+				perf_event_name(perf_event::instructions), d[perf_event::instructions],
+				perf_event_name(perf_event::cache_misses), d[perf_event::cache_misses],
+				perf_event_name(perf_event::branch_misses), d[perf_event::branch_misses]);
+	else
+		print(name, "time_ns", d.time.count(), "counters unavailable");
+}
+
+BUBBLE_INLINE perf_sample perf_region::elapsed() const {
+	return counters.read() - start;
+}
+
+#ifdef __linux__
+#include <cerrno>
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace detail {
+
+BUBBLE_INLINE int open_event(std::uint64_t config, int group_fd) {
+	perf_event_attr attr;
+	std::memset(&attr, 0, sizeof(attr));
+	attr.size = sizeof(attr);
+	attr.type = PERF_TYPE_HARDWARE;
+	attr.config = config;
+	attr.disabled = group_fd == -1 ? 1 : 0; //the leader starts the whole group
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+	attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_ID;
+	return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, group_fd, 0));
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+BUBBLE_INLINE std::uint64_t read_pmc(std::uint32_t counter) {
+	std::uint32_t low, high;
+	asm volatile("rdpmc" : "=a"(low), "=d"(high) : "c"(counter));
+	return static_cast<std::uint64_t>(high) << 32 | low;
+}
+
+/// reads a counter in user space, as described in linux/perf_event.h
+BUBBLE_INLINE bool read_user_space(const void* page, std::uint64_t& value) {
+	const auto* pc = static_cast<const volatile perf_event_mmap_page*>(page);
+	std::uint32_t sequence;
+	do {
+		sequence = pc->lock;
+		asm volatile("" : : : "memory");
+		const auto index = pc->index;
+		if (!pc->cap_user_rdpmc || index == 0)
+			return false;
+		//sign extend the counter from its width
+		const auto width = pc->pmc_width;
+		auto count = static_cast<std::int64_t>(read_pmc(index - 1) << (64 - width));
+		count >>= 64 - width;
+		value = static_cast<std::uint64_t>(pc->offset + count);
+		asm volatile("" : : : "memory");
+	} while (pc->lock != sequence);
+	return true;
+}
+#else
+BUBBLE_INLINE bool read_user_space(const void*, std::uint64_t&) {
+	return false;
+}
+#endif
+
+} // namespace detail
+
+BUBBLE_INLINE perf_counter_group::perf_counter_group() {
+	constexpr std::uint64_t event_config[perf_event_count] = {
+		PERF_COUNT_HW_CPU_CYCLES,
+		PERF_COUNT_HW_INSTRUCTIONS,
+		PERF_COUNT_HW_CACHE_MISSES,
+		PERF_COUNT_HW_BRANCH_MISSES,
+	};
+	for (std::size_t i = 0; i < perf_event_count; ++i) {
+		events[i].fd = detail::open_event(event_config[i], events[0].fd);
+		if (i == 0 && events[0].fd < 0)
+			return; //no leader, no counters at all
+	}
+
+	const auto page_size = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+	rdpmc = true;
+	for (auto& e : events) {
+		if (e.fd < 0)
+			continue;
+		auto* page = mmap(nullptr, page_size, PROT_READ, MAP_SHARED, e.fd, 0);
+		if (page == MAP_FAILED) {
+			rdpmc = false;
+			continue;
+		}
+		e.page = page;
+		rdpmc = rdpmc && static_cast<perf_event_mmap_page*>(page)->cap_user_rdpmc;
+	}
+	for (auto& e : events)
+		if (e.fd >= 0)
+			ioctl(e.fd, PERF_EVENT_IOC_ID, &e.id);
+
+	ioctl(events[0].fd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+	ioctl(events[0].fd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+
+	//the index for rdpmc is only valid once the counters are scheduled, check it now
+	std::uint64_t value;
+	for (const auto& e : events)
+		if (e.page && !detail::read_user_space(e.page, value))
+			rdpmc = false;
+}
+
+BUBBLE_INLINE perf_counter_group::~perf_counter_group() {
+	const auto page_size = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+	for (auto& e : events) {
+		if (e.page)
+			munmap(e.page, page_size);
+		if (e.fd >= 0)
+			close(e.fd);
+	}
+}
+
+BUBBLE_INLINE bool perf_counter_group::uses_rdpmc() const {
+	return rdpmc;
+}
+
+BUBBLE_INLINE perf_sample perf_counter_group::read() const {
+	perf_sample sample;
+	sample.time = std::chrono::steady_clock::now().time_since_epoch();
+	if (!available())
+		return sample;
+
+	if (rdpmc) {
+		bool complete = true;
+		for (std::size_t i = 0; i < perf_event_count && complete; ++i)
+			if (events[i].page)
+				complete = detail::read_user_space(events[i].page, sample.counts[i]);
+		if (complete)
+			return sample;
+		//counters were descheduled, fall back to the system call
+		sample.counts = { };
+	}
+
+	//layout of PERF_FORMAT_GROUP | PERF_FORMAT_ID: nr, then pairs of value and id
+	std::uint64_t buffer[1 + 2 * perf_event_count];
+	if (::read(events[0].fd, buffer, sizeof(buffer)) <= 0)
+		return sample;
+	for (std::uint64_t n = 0; n < buffer[0] && n < perf_event_count; ++n) {
+		for (std::size_t i = 0; i < perf_event_count; ++i)
+			if (events[i].fd >= 0 && events[i].id == buffer[2 + 2 * n])
+				sample.counts[i] = buffer[1 + 2 * n];
+	}
+	return sample;
+}
+
+#else
+
+//no perf_event_open, measure time only
+BUBBLE_INLINE perf_counter_group::perf_counter_group() {
+}
+
+BUBBLE_INLINE perf_counter_group::~perf_counter_group() {
+}
+
+BUBBLE_INLINE bool perf_counter_group::uses_rdpmc() const {
+	return false;
+}
+
+BUBBLE_INLINE perf_sample perf_counter_group::read() const {
+	perf_sample sample;
+	sample.time = std::chrono::steady_clock::now().time_since_epoch();
+	return sample;
+}
+
+#endif
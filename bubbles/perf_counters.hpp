@@ -0,0 +1,154 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Caspar Kielwein
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef BUBBLES_PERF_COUNTERS_HPP_
+#define BUBBLES_PERF_COUNTERS_HPP_
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+/*
+ * Hardware performance counters for hot paths, based on Linux perf_event_open.
+ *
+ * perf_counter_group opens cycles, instructions, cache misses and branch misses
+ * as one group, which is scheduled on the PMU together.
+ * Where the kernel permits it, counters are read in user space with rdpmc,
+ * otherwise with a single read system call for the whole group.
+ *
+ * If perf_event_open is not available, e.g. on other operating systems, in containers
+ * or with a restrictive /proc/sys/kernel/perf_event_paranoid, the group still measures time.
+ *
+ * ~~~{.cpp}
+ * perf_counter_group counters;
+ * {
+ *     perf_region region { "parse", counters };
+ *     parse(input);
+ * } // prints: parse; time_ns; 1234; cycles; 4567; instructions; ...
+ * ~~~
+ */
+
+/// hardware events counted by perf_counter_group
+enum class perf_event {
+	cycles, instructions, cache_misses, branch_misses
+};
+
+constexpr std::size_t perf_event_count = 4;
+
+/// counter values at a point in time, or the difference between two points
+struct perf_sample {
+	std::chrono::nanoseconds time { 0 };
+	std::array<std::uint64_t, perf_event_count> counts { };
+
+	std::uint64_t operator[](perf_event e) const {
+		return counts[static_cast<std::size_t>(e)];
+	}
+};
+
+/// difference of two samples, the counts of \p later minus those of \p earlier
+perf_sample operator-(const perf_sample& later, const perf_sample& earlier);
+
+/// name of the event, suitable for printing
+const char* perf_event_name(perf_event e);
+
+/**
+ * \brief a group of hardware performance counters for the calling thread
+ *
+ * Counters count only user space events of the thread which created the group.
+ * \author ckielwein
+ */
+class perf_counter_group {
+public:
+	/// opens and starts all counters which are available
+	perf_counter_group();
+	~perf_counter_group();
+
+	perf_counter_group(const perf_counter_group&) = delete;
+	perf_counter_group& operator=(const perf_counter_group&) = delete;
+
+	/// true if event \p e is counted, false if only time is measured for it
+	bool available(perf_event e) const {
+		return events[static_cast<std::size_t>(e)].fd >= 0;
+	}
+
+	/// true if at least one hardware counter could be opened
+	bool available() const {
+		return events[0].fd >= 0;
+	}
+
+	/// true if counters are read in user space, without a system call
+	bool uses_rdpmc() const;
+
+	/// current values of all counters, unavailable counters are 0
+	perf_sample read() const;
+
+private:
+	struct event {
+		int fd = -1;
+		void* page = nullptr; //mmapped perf_event_mmap_page for rdpmc
+		std::uint64_t id = 0; //identifies the event in a group read
+	};
+	std::array<event, perf_event_count> events;
+	bool rdpmc = false;
+};
+
+/**
+ * \brief measures the counters of a region in RAII style, like scope_exit.
+ *
+ * On destruction the difference of all counters since construction
+ * is printed with print().
+ * If no counters are available only the time is printed.
+ */
+class perf_region {
+public:
+	perf_region(const char* name, const perf_counter_group& counters);
+	~perf_region();
+
+	perf_region(const perf_region&) = delete;
+	perf_region& operator=(const perf_region&) = delete;
+
+	/// counter differences since construction
+	perf_sample elapsed() const;
+
+	/// dismisses the region, nothing is printed on destruction
+	void release() {
+		active = false;
+	}
+
+private:
+	const char* name;
+	const perf_counter_group& counters;
+	perf_sample start;
+	bool active = true;
+};
+
+#if BUBBLE_HEADER_ONLY
+	#include "perf_counters.cpp"
+#endif
+#endif /* BUBBLES_PERF_COUNTERS_HPP_ */
@@ -0,0 +1,72 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Caspar Kielwein
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "perf_counters.hpp"
+
+#include <cassert>
+#include <iostream>
+#include <vector>
+
+int main() {
+	perf_counter_group counters;
+	std::cout << "hardware counters available: " << std::boolalpha << counters.available()
+			<< ", read with rdpmc: " << counters.uses_rdpmc() << '\n';
+
+	const auto before = counters.read();
+	std::vector<long> values(100000, 1);
+	long sum = 0;
+	for (auto v : values)
+		sum += v;
+	const auto after = counters.read();
+	const auto d = after - before;
+
+	assert(sum == 100000);
+	assert(d.time.count() > 0);
+	if (counters.available()) {
+		assert(counters.available(perf_event::cycles));
+		assert(d[perf_event::instructions] > 100000);
+	} else {
+		//degrades to timing only
+		assert(d[perf_event::cycles] == 0);
+		assert(!counters.uses_rdpmc());
+	}
+
+	{
+		perf_region region { "sum", counters };
+		for (auto v : values)
+			sum += v;
+		assert(region.elapsed().time.count() > 0);
+	}
+
+	{
+		perf_region region { "released", counters };
+		region.release(); //prints nothing
+	}
+
+	return 0;
+}
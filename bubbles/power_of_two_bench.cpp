@@ -0,0 +1,73 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Caspar Kielwein
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "power_of_two.hpp"
+#include "benchmark.hpp"
+
+#include <cstdint>
+
+/*
+ * Compares is_power_of_two and next_power_of_two with naive loops.
+ */
+
+namespace {
+
+bool naive_is_power_of_two(std::uint64_t x) {
+	if (x == 0)
+		return false;
+	while (x % 2 == 0)
+		x /= 2;
+	return x == 1;
+}
+
+std::uint64_t naive_next_power_of_two(std::uint64_t x) {
+	std::uint64_t p = 1;
+	while (p < x)
+		p *= 2;
+	return p;
+}
+
+std::uint64_t value = 1;
+
+BENCHMARK("naive is_power_of_two", [] {
+	do_not_optimize(naive_is_power_of_two(value++));
+});
+
+BENCHMARK("is_power_of_two", [] {
+	do_not_optimize(is_power_of_two(value++));
+});
+
+BENCHMARK("naive next_power_of_two", [] {
+	do_not_optimize(naive_next_power_of_two(value++ & 0xffffffff));
+});
+
+BENCHMARK("next_power_of_two", [] {
+	do_not_optimize(next_power_of_two(value++ & 0xffffffff));
+});
+
+} // namespace
@@ -32,16 +32,29 @@
 #include <iostream>
 #include <utility>
 
+#if __cpp_consteval
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <string_view>
+#include <type_traits>
+#endif
+
 namespace detail {
 
-static constexpr auto deliminiter = "; ";
+/// a function and not a static variable, so that templates using it have no internal linkage dependency
+constexpr const char* deliminiter() {
+	return "; ";
+}
 
 template<class T>
 void print_impl(const T& v) {
 	std::cout << v;
 }
 
-void print_impl(const bool v) {
+inline void print_impl(const bool v) {
 	std::cout << std::boolalpha << v;
 }
 
@@ -67,26 +80,250 @@ void print(const T1& t1) {
 template<class T1, class ... T>
 void print(const T1& t1, const T&... t) {
 	detail::print_impl(t1);
-	detail::print_impl(+detail::deliminiter);
+	detail::print_impl(detail::deliminiter());
 	print(t...);
 }
 
-/// prints contents of any container or other range
+/// prints contents of any container or other range, also single pass ranges like generator
 template<class T>
-void print_range(const T& v) {
-	if (v.empty()) {
+void print_range(T&& v) {
+	auto i = begin(v);
+	const auto last = end(v);
+	if (i == last) {
 		std::cout << "range empty";
 		return;
 	}
 	std::cout << '[';
-	detail::print_impl(*begin(v));
-	for (auto i = std::next(begin(v)); i != end(v); ++i) {
+	detail::print_impl(*i);
+	for (++i; i != last; ++i) {
 		std::cout << ", ";
 		detail::print_impl(*i);
 	}
 	std::cout << "]\n";
 }
 
+#if __cpp_consteval
+
+namespace detail {
+
+/// conversion requested by a replacement field of print_fmt
+enum class fmt_type {
+	any, dec, hex, fixed, scientific, string
+};
+
+/// which conversions an argument type allows
+enum class fmt_kind {
+	integral, floating, string, other
+};
+
+template<class T>
+constexpr fmt_kind fmt_kind_of() {
+	using U = std::remove_cv_t<std::decay_t<T>>;
+	if constexpr (std::is_same_v<U, bool> || std::is_same_v<U, char> || std::is_same_v<U, signed char>
+			|| std::is_same_v<U, unsigned char>)
+		return fmt_kind::other; //printed as true/false and characters, like print does
+	else if constexpr (std::is_integral_v<U>)
+		return fmt_kind::integral;
+	else if constexpr (std::is_same_v<U, float> || std::is_same_v<U, double>)
+		return fmt_kind::floating;
+	else if constexpr (std::is_convertible_v<const T&, std::string_view>)
+		return fmt_kind::string;
+	else
+		return fmt_kind::other;
+}
+
+struct fmt_field {
+	fmt_type type = fmt_type::any;
+	int precision = -1;
+};
+
+/// format string cut into literals and fields: literal 0, field 0, literal 1, ..., literal N
+template<std::size_t N>
+struct parsed_format {
+	std::array<std::string_view, N + 1> literals { };
+	/// the literal contains {{ or }}, which print as a single brace
+	std::array<bool, N + 1> escaped { };
+	std::array<fmt_field, N> fields { };
+	/// description of the first error, nullptr if the format string matches the arguments
+	const char* error = nullptr;
+};
+
+constexpr const char* parse_fmt_spec(std::string_view spec, fmt_kind kind, fmt_field& field) {
+	if (spec.empty())
+		return nullptr;
+	if (spec.front() != ':' || spec.size() < 2)
+		return "print_fmt: expected {} or {:spec}";
+	spec.remove_prefix(1);
+	if (spec.front() == '.') {
+		spec.remove_prefix(1);
+		field.precision = 0;
+		for (; !spec.empty() && spec.front() >= '0' && spec.front() <= '9'; spec.remove_prefix(1))
+			field.precision = field.precision * 10 + (spec.front() - '0');
+		if (field.precision > 99)
+			return "print_fmt: precision larger than 99";
+	}
+	if (spec.size() != 1)
+		return "print_fmt: expected a single conversion d, x, f, e or s";
+	switch (spec.front()) {
+	case 'd':
+		field.type = fmt_type::dec;
+		break;
+	case 'x':
+		field.type = fmt_type::hex;
+		break;
+	case 'f':
+		field.type = fmt_type::fixed;
+		break;
+	case 'e':
+		field.type = fmt_type::scientific;
+		break;
+	case 's':
+		field.type = fmt_type::string;
+		break;
+	default:
+		return "print_fmt: unknown conversion, expected d, x, f, e or s";
+	}
+	const bool fits = field.type == fmt_type::dec || field.type == fmt_type::hex ? kind == fmt_kind::integral
+			: field.type == fmt_type::string ? kind == fmt_kind::string : kind == fmt_kind::floating;
+	if (!fits)
+		return "print_fmt: conversion does not match the type of the argument";
+	if (field.precision >= 0 && kind != fmt_kind::floating)
+		return "print_fmt: precision is only allowed for floating point arguments";
+	return nullptr;
+}
+
+/// parses \p text and checks its fields against Args, at compile time if called in a constant expression
+template<class ... Args>
+constexpr parsed_format<sizeof...(Args)> parse_fmt(std::string_view text) {
+	constexpr std::array<fmt_kind, sizeof...(Args)> kinds { fmt_kind_of<Args>()... };
+	parsed_format<sizeof...(Args)> result;
+	std::size_t field = 0;
+	std::size_t start = 0;
+	bool escaped = false;
+	for (std::size_t i = 0; i < text.size() && !result.error; ++i) {
+		if ((text[i] == '{' || text[i] == '}') && i + 1 < text.size() && text[i + 1] == text[i]) {
+			escaped = true;
+			++i;
+		} else if (text[i] == '}') {
+			result.error = "print_fmt: unmatched }";
+		} else if (text[i] == '{') {
+			const auto close = text.find('}', i);
+			if (close == text.npos)
+				result.error = "print_fmt: unterminated {";
+			else if (field == sizeof...(Args))
+				result.error = "print_fmt: more fields than arguments";
+			else {
+				result.literals[field] = text.substr(start, i - start);
+				result.escaped[field] = escaped;
+				result.error = parse_fmt_spec(text.substr(i + 1, close - i - 1), kinds[field], result.fields[field]);
+				escaped = false;
+				++field;
+				i = close;
+				start = close + 1;
+			}
+		}
+	}
+	if (!result.error && field != sizeof...(Args))
+		result.error = "print_fmt: fewer fields than arguments";
+	if (!result.error) {
+		result.literals[field] = text.substr(start);
+		result.escaped[field] = escaped;
+	}
+	return result;
+}
+
+/// not constexpr, so that calling it during constant evaluation fails to compile
+inline void format_string_does_not_match_arguments(const char* message) {
+	std::cerr << message << '\n';
+}
+
+inline void write_fmt_literal(std::streambuf& out, std::string_view literal, bool escaped) {
+	if (!escaped) {
+		out.sputn(literal.data(), static_cast<std::streamsize>(literal.size()));
+		return;
+	}
+	for (std::size_t i = 0; i < literal.size(); ++i) {
+		out.sputc(literal[i]);
+		if (literal[i] == '{' || literal[i] == '}')
+			++i;
+	}
+}
+
+template<class T>
+void write_fmt_field(std::streambuf& out, fmt_field field, const T& v) {
+	constexpr auto kind = fmt_kind_of<T>();
+	if constexpr (kind == fmt_kind::integral) {
+		char buffer[std::numeric_limits<T>::digits + 2];
+		const auto r = std::to_chars(buffer, std::end(buffer), v, field.type == fmt_type::hex ? 16 : 10);
+		out.sputn(buffer, r.ptr - buffer);
+	} else if constexpr (kind == fmt_kind::floating) {
+		//fixed notation of the largest double, with the largest precision
+		char buffer[std::numeric_limits<double>::max_exponent10 + 104];
+		const auto r = field.type == fmt_type::any ? std::to_chars(buffer, std::end(buffer), v)
+				: std::to_chars(buffer, std::end(buffer), v,
+						field.type == fmt_type::fixed ? std::chars_format::fixed : std::chars_format::scientific,
+						field.precision < 0 ? 6 : field.precision);
+		out.sputn(buffer, r.ptr - buffer);
+	} else if constexpr (kind == fmt_kind::string) {
+		const std::string_view s { v };
+		out.sputn(s.data(), static_cast<std::streamsize>(s.size()));
+	} else {
+		print_impl(v);
+	}
+}
+
+template<class ... Args, std::size_t ... I>
+void print_fmt_impl(const parsed_format<sizeof...(Args)>& format, std::index_sequence<I...>, const Args&... args) {
+	auto& out = *std::cout.rdbuf();
+	(..., (write_fmt_literal(out, format.literals[I], format.escaped[I]), write_fmt_field(out, format.fields[I], args)));
+	write_fmt_literal(out, format.literals.back(), format.escaped.back());
+	out.sputc('\n');
+}
+
+} // namespace detail
+
+/**
+ * \brief format string of print_fmt, parsed and checked against the argument types at compile time.
+ *
+ * Fields are {} for any printable argument, {:d} and {:x} for integers in decimal and hex,
+ * {:f} and {:e} with an optional precision like {:.2f} for float and double and {:s} for strings.
+ * {{ and }} print a single brace.
+ */
+template<class ... Args>
+class format_string {
+public:
+	template<class S, class = std::enable_if_t<std::is_convertible_v<const S&, std::string_view>>>
+	consteval format_string(const S& text) :
+			format { detail::parse_fmt<Args...>(text) } {
+		if (format.error)
+			detail::format_string_does_not_match_arguments(format.error);
+	}
+
+	constexpr const detail::parsed_format<sizeof...(Args)>& parsed() const {
+		return format;
+	}
+
+private:
+	detail::parsed_format<sizeof...(Args)> format;
+};
+
+/**
+ * \brief prints a format string with arguments to cout, followed by a newline.
+ *
+ * The format string is parsed at compile time, a field, which does not match its argument,
+ * fails to compile. At runtime print_fmt only writes the literals and converts the arguments.
+ * ~~~{.cpp}
+ * print_fmt("request {} took {:.2f} ms, status {:x}", id, millis, status);
+ * ~~~
+ * Requires C++20.
+ */
+template<class ... Args>
+void print_fmt(format_string<std::type_identity_t<Args>...> format, const Args&... args) {
+	detail::print_fmt_impl(format.parsed(), std::index_sequence_for<Args...> { }, args...);
+}
+
+#endif
+
 /// prints file, function and line number to cout
 #define PRINT_TRACE() \
 	std::cout << __FILE__ << ':' <<__LINE__ << ' ' <<  __FUNCTION__ << '\n';
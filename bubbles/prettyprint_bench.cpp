@@ -0,0 +1,122 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Caspar Kielwein
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "prettyprint.hpp"
+#include "benchmark.hpp"
+
+#include <cstdio>
+#include <iomanip>
+#include <iostream>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+/*
+ * Compares print and print_range with hand written output to std::cout,
+ * and print_fmt with print, iostream and fprintf on records of mixed types.
+ * std::cout is redirected to a buffer which discards everything, to measure only formatting,
+ * fprintf writes to /dev/null.
+ */
+
+namespace {
+
+class null_buffer : public std::streambuf {
+protected:
+	int overflow(int c) override {
+		return c;
+	}
+	std::streamsize xsputn(const char*, std::streamsize n) override {
+		return n;
+	}
+};
+
+/// runs body iterations times, with std::cout discarding all output
+template<class F>
+auto silenced(F body) {
+	return [body](std::size_t iterations) {
+		null_buffer discard;
+		auto* original = std::cout.rdbuf(&discard);
+		for (std::size_t i = 0; i < iterations; ++i)
+			body();
+		std::cout.rdbuf(original);
+	};
+}
+
+const std::vector<int> values { 1, 2, 3, 4, 5, 6, 7, 8 };
+
+BENCHMARK("std::cout, int, string and double", silenced([] {
+	std::cout << 42 << "; " << "foo" << "; " << 3.14 << '\n';
+}));
+
+BENCHMARK("print, int, string and double", silenced([] {
+	print(42, "foo", 3.14);
+}));
+
+BENCHMARK("std::cout, 8 ints", silenced([] {
+	std::cout << '[' << values[0];
+	for (std::size_t i = 1; i < values.size(); ++i)
+		std::cout << ", " << values[i];
+	std::cout << "]\n";
+}));
+
+BENCHMARK("print_range, 8 ints", silenced([] {
+	print_range(values);
+}));
+
+const int id = 4711;
+const std::string user = "ckielwein";
+const double millis = 12.3456;
+
+//a stream of its own, so that the manipulators do not change the format of std::cout
+BENCHMARK("std::ostream, record", [](std::size_t iterations) {
+	null_buffer discard;
+	std::ostream out { &discard };
+	for (std::size_t i = 0; i < iterations; ++i)
+		out << "request " << id << " by " << user << " took " << std::fixed << std::setprecision(2) << millis
+				<< " ms\n";
+});
+
+BENCHMARK("print, record", silenced([] {
+	print(id, user, millis);
+}));
+
+BENCHMARK("fprintf, record", [](std::size_t iterations) {
+	auto* null = std::fopen("/dev/null", "w");
+	for (std::size_t i = 0; i < iterations; ++i)
+		std::fprintf(null, "request %d by %s took %.2f ms\n", id, user.c_str(), millis);
+	std::fclose(null);
+});
+
+#if __cpp_consteval
+BENCHMARK("print_fmt, record", silenced([] {
+	print_fmt("request {} by {} took {:.2f} ms", id, user, millis);
+}));
+#endif
+
+} // namespace
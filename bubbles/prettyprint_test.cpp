@@ -30,8 +30,33 @@
 
 #include <cassert>
 #include <iostream>
+#include <sstream>
+#include <string>
 #include <vector>
 
+#if __cpp_consteval
+//format strings are checked at compile time
+static_assert(!detail::parse_fmt<int, double>("{} {:.3f}").error);
+static_assert(!detail::parse_fmt<>("{{no fields}}").error);
+static_assert(detail::parse_fmt<int>("{} {}").error);
+static_assert(detail::parse_fmt<int, int>("{}").error);
+static_assert(detail::parse_fmt<double>("{:d}").error);
+static_assert(detail::parse_fmt<int>("{:s}").error);
+static_assert(detail::parse_fmt<int>("{:.2d}").error);
+static_assert(detail::parse_fmt<int>("{").error);
+static_assert(detail::parse_fmt<int>("{} }").error);
+
+/// output of print_fmt as string
+template<class ... Args>
+std::string formatted(format_string<std::type_identity_t<Args>...> format, const Args&... args) {
+	std::ostringstream out;
+	auto* original = std::cout.rdbuf(out.rdbuf());
+	print_fmt(format, args...);
+	std::cout.rdbuf(original);
+	return out.str();
+}
+#endif
+
 int main() {
 
 	print("pretty print example");
@@ -46,5 +71,15 @@ int main() {
 
 	PRINT_TRACE();
 
+#if __cpp_consteval
+	print_fmt("{} is {:.1f} and {}", "pi", 3.14159, std::make_pair(1, 2));
+
+	assert(formatted("plain") == "plain\n");
+	assert(formatted("{} {:x} {:d}", 42, 255, -7L) == "42 ff -7\n");
+	assert(formatted("{:.2f} {:e} {}", 3.14159, 1500.0, 0.5f) == "3.14 1.500000e+03 0.5\n");
+	assert(formatted("{} {:s} {}", "foo", std::string { "bar" }, 'c') == "foo bar c\n");
+	assert(formatted("{{{}}}", true) == "{true}\n");
+#endif
+
 	return 0;
 }
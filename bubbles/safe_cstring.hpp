@@ -29,9 +29,15 @@
 #ifndef BUBBLES_SAFE_CSTRING_HPP_
 #define BUBBLES_SAFE_CSTRING_HPP_
 
+#include <array>
+#include <cassert>
 #include <cstring>
 #include <type_traits>
 
+#if __cplusplus > 201703L && __has_include(<span>)
+#include <span>
+#endif
+
 /**
  * \brief memcpy with a static check if memcpy is safe to use on types
  * \param dest pointer to the memory location to copy to
@@ -117,4 +123,96 @@ void* safe_memset(T* dest, int ch, std::size_t count) {
 	return std::memset(dest, ch, count);
 }
 
+namespace detail {
+
+template<class T, class S>
+void check_typed_copy() {
+	static_assert(std::is_trivially_copyable<T>::value,
+			"Target type of safe_copy needs to be trivially copyable");
+	static_assert(std::is_trivially_copyable<S>::value,
+			"Source type of safe_copy needs to be trivially copyable");
+	static_assert(sizeof(T) == sizeof(S),
+			"safe_copy counts elements, Source and Target Types need to be the same size");
+}
+
+} // namespace detail
+
+/**
+ * \brief copies \p count elements from \p src to \p dest
+ * \param dest pointer to the first element to copy to
+ * \param src pointer to the first element to copy from
+ * \param count number of elements (not bytes) to copy
+ * \return \p dest
+ *
+ * safe_copy_n takes an element count instead of the byte count of memcpy.
+ * This removes the usual source of errors with memcpy,
+ * namely a forgotten or wrong sizeof.
+ * Source and target type need to be trivially copyable and of the same size.
+ *
+ * Ranges must not overlap, just as with memcpy.
+ */
+template<class T, class S>
+T* safe_copy_n(T* dest, const S* src, std::size_t count) {
+	detail::check_typed_copy<T, S>();
+	std::memcpy(dest, src, count * sizeof(T));
+	return dest;
+}
+
+/**
+ * \brief copies exactly \p N elements from \p src to \p dest
+ * \tparam N number of elements to copy
+ * \param dest pointer to the first element to copy to
+ * \param src pointer to the first element to copy from
+ * \return \p dest
+ *
+ * Since the size of the copy is known at compile time,
+ * gcc and clang replace the call to memcpy with a few inline (vector) moves
+ * for small and medium sized copies.
+ * ~~~{.cpp}
+ * safe_copy<4>(dest, src); //copies 4 * sizeof(*dest) bytes
+ * ~~~
+ */
+template<std::size_t N, class T, class S>
+T* safe_copy(T* dest, const S* src) {
+	detail::check_typed_copy<T, S>();
+	std::memcpy(dest, src, N * sizeof(T));
+	return dest;
+}
+
+/**
+ * \brief copies a whole array, size is inferred from the types.
+ * \return pointer to the first element of \p dest
+ */
+template<class T, class S, std::size_t N>
+T* safe_copy(T (&dest)[N], const S (&src)[N]) {
+	return safe_copy<N>(dest, src);
+}
+
+/// \copydoc safe_copy(T (&)[N], const S (&)[N])
+template<class T, class S, std::size_t N>
+T* safe_copy(std::array<T, N>& dest, const std::array<S, N>& src) {
+	return safe_copy<N>(dest.data(), src.data());
+}
+
+#if __cpp_lib_span >= 202002L
+/**
+ * \brief copies all elements of \p src to the beginning of \p dest
+ * \return pointer to the first element of \p dest
+ * \pre dest.size() >= src.size()
+ *
+ * If both spans have a static extent, the size is checked at compile time
+ * and the copy is done with a compile time size.
+ */
+template<class T, std::size_t DestExtent, class S, std::size_t SrcExtent>
+T* safe_copy(std::span<T, DestExtent> dest, std::span<S, SrcExtent> src) {
+	if constexpr (DestExtent != std::dynamic_extent && SrcExtent != std::dynamic_extent) {
+		static_assert(DestExtent >= SrcExtent, "safe_copy target span is too small");
+		return safe_copy<SrcExtent>(dest.data(), src.data());
+	} else {
+		assert(dest.size() >= src.size());
+		return safe_copy_n(dest.data(), src.data(), src.size());
+	}
+}
+#endif
+
 #endif /* BUBBLES_SAFE_CSTRING_HPP_ */
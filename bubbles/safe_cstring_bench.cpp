@@ -0,0 +1,104 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Caspar Kielwein
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "safe_cstring.hpp"
+#include "benchmark.hpp"
+
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+/*
+ * Compares the fixed size safe_copy<N> against memcpy with a runtime byte count,
+ * and the safe_ functions against their plain cstring baselines.
+ *
+ * To look at the generated code, compile with
+ * g++ -std=c++14 -O2 -S safe_cstring_bench.cpp
+ * copy_fixed consists of a few (vector) moves, while copy_runtime calls memcpy.
+ */
+
+namespace {
+
+struct record {
+	double position[3];
+	double velocity[3];
+	long id;
+	long flags;
+};
+
+BENCHMARK_NOINLINE void copy_fixed(record* dest, const record* src) {
+	safe_copy<1>(dest, src);
+}
+
+BENCHMARK_NOINLINE void copy_runtime(record* dest, const record* src, std::size_t bytes) {
+	std::memcpy(dest, src, bytes);
+}
+
+constexpr std::size_t count = 1 << 10;
+std::vector<record> src(count);
+std::vector<record> dest(count);
+volatile std::size_t record_size = sizeof(record); //hides the size from the optimizer
+
+BENCHMARK("safe_copy<1>(record)", [] {
+	for (std::size_t i = 0; i < count; ++i)
+		copy_fixed(&dest[i], &src[i]);
+	clobber_memory();
+});
+
+BENCHMARK("memcpy(record), runtime size", [] {
+	for (std::size_t i = 0; i < count; ++i)
+		copy_runtime(&dest[i], &src[i], record_size);
+	clobber_memory();
+});
+
+BENCHMARK("safe_memcpy, 1024 records", [] {
+	safe_memcpy(dest.data(), src.data(), count * sizeof(record));
+	clobber_memory();
+});
+
+BENCHMARK("memcpy, 1024 records", [] {
+	std::memcpy(dest.data(), src.data(), count * sizeof(record));
+	clobber_memory();
+});
+
+BENCHMARK("safe_copy_n, 1024 records", [] {
+	safe_copy_n(dest.data(), src.data(), count);
+	clobber_memory();
+});
+
+BENCHMARK("safe_memset, 1024 records", [] {
+	safe_memset(dest.data(), 0, count * sizeof(record));
+	clobber_memory();
+});
+
+BENCHMARK("memset, 1024 records", [] {
+	std::memset(dest.data(), 0, count * sizeof(record));
+	clobber_memory();
+});
+
+} // namespace
@@ -0,0 +1,78 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Caspar Kielwein
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "safe_cstring.hpp"
+
+#include <array>
+#include <cassert>
+
+struct point {
+	float x, y, z;
+};
+
+bool operator==(const point& l, const point& r) {
+	return l.x == r.x && l.y == r.y && l.z == r.z;
+}
+
+int main() {
+
+	int a[4] { 1, 2, 3, 4 };
+	int b[4] { };
+
+	safe_memcpy(b, a, sizeof(a));
+	assert(b[3] == 4);
+
+	safe_memset(b, 0, sizeof(b));
+	assert(b[0] == 0 && b[3] == 0);
+
+	//counts elements, not bytes
+	assert(safe_copy_n(b, a, 2) == b);
+	assert(b[0] == 1 && b[1] == 2 && b[2] == 0);
+
+	assert(safe_copy<3>(b, a) == b);
+	assert(b[2] == 3 && b[3] == 0);
+
+	//unsigned has the same size as int, so this is allowed
+	unsigned u[4] { };
+	safe_copy(u, a);
+	assert(u[3] == 4u);
+
+	std::array<point, 2> points { { { 1, 2, 3 }, { 4, 5, 6 } } };
+	std::array<point, 2> copies { };
+	safe_copy(copies, points);
+	assert(copies == points);
+
+#if __cpp_lib_span >= 202002L
+	point more[3] { };
+	safe_copy(std::span<point> { more }, std::span<const point, 2> { points });
+	assert(more[1] == points[1]);
+	assert(more[2] == point {});
+#endif
+
+	return 0;
+}
@@ -30,6 +30,7 @@
 #define BUBBLES_SCOPE_EXIT_HPP_
 
 #include <exception>
+#include <type_traits>
 #include <utility>
 
 /*
@@ -40,42 +41,104 @@
  * This is basically BOOST_SCOPE_EXIT without the preprocessor.
  * Since we have lambdas after C++11 we don't really need the macros anymore.
  *
- * Warning: Don't use scope_failure or scope_success in destructors.
- * When the destructor is called during stack unwinding,
- * scope_failure/success might not behave as expected.
+ * scope_failure and scope_success compare the number of uncaught exceptions
+ * on construction and destruction.
+ * Thus they also behave as expected when used in destructors,
+ * which are called during stack unwinding.
  * see: http://www.gotw.ca/gotw/047.htm
+ * and: https://isocpp.org/files/papers/N4152.pdf
  */
 
-/// executes a callback on destruction, used by scope_exit and variants.
-template<class Callback>
-class scope_handler {
+namespace detail {
+
+inline int uncaught_exceptions() noexcept {
+#if __cpp_lib_uncaught_exceptions
+	return std::uncaught_exceptions();
+#else
+	//best we can do before C++17, wrong during nested stack unwinding
+	return std::uncaught_exception() ? 1 : 0;
+#endif
+}
+
+/// policy for scope_handler, which always executes
+struct on_exit {
+	bool should_execute() const noexcept {
+		return true;
+	}
+};
+
+/// policy for scope_handler, which executes if an exception was thrown since construction
+class on_failure {
 public:
-	explicit scope_handler(Callback callback) :
-			c(std::move(callback)) {
+	bool should_execute() const noexcept {
+		return uncaught_exceptions() > exceptions;
 	}
+private:
+	int exceptions = uncaught_exceptions();
+};
+
+/// policy for scope_handler, which executes if no exception was thrown since construction
+class on_success {
+public:
+	bool should_execute() const noexcept {
+		return uncaught_exceptions() <= exceptions;
+	}
+private:
+	int exceptions = uncaught_exceptions();
+};
 
-	scope_handler(scope_handler&&) = default;
+} // namespace detail
+
+/**
+ * \brief executes a callback on destruction, used by scope_exit and variants.
+ *
+ * scope_handler is move only. The moved from handler does not execute the callback.
+ * The callback is stored directly in the handler, no copies of it are made.
+ *
+ * \tparam Callback callable type which is executed
+ * \tparam Policy decides on destruction if the callback is executed
+ */
+template<class Callback, class Policy = detail::on_exit>
+class scope_handler : private Policy {
+public:
+	template<class C, class = std::enable_if_t<!std::is_same<std::decay_t<C>, scope_handler>::value>>
+	explicit scope_handler(C&& callback) noexcept(std::is_nothrow_constructible<Callback, C>::value) :
+			c(std::forward<C>(callback)) {
+	}
+
+	scope_handler(scope_handler&& other) noexcept(std::is_nothrow_move_constructible<Callback>::value) :
+			Policy(other), c(std::move(other.c)), active(other.active) {
+		other.release();
+	}
 
 	///we don't allow copying or assignment since that would be very confusing
 	scope_handler(const scope_handler&) = delete;
 	scope_handler& operator=(scope_handler&&) = delete;
 	scope_handler& operator=(const scope_handler&) = delete;
 
-	~scope_handler() {
-		c();
+	~scope_handler() noexcept(noexcept(std::declval<Callback&>()())) {
+		if (active && Policy::should_execute())
+			c();
 	}
+
+	/// dismisses the handler, the callback will not be executed.
+	void release() noexcept {
+		active = false;
+	}
+
 private:
 	Callback c;
+	bool active = true;
 };
 
 /**
- * \brief scope_failure executes if the current scope is left.
+ * \brief scope_exit executes if the current scope is left.
  * \param callback is executed on end of scope
  * \return scope_handler which does the execution in its destructor
  */
 template<class T>
-auto scope_exit(T callback) {
-	return scope_handler<T>(std::move(callback));
+auto scope_exit(T&& callback) {
+	return scope_handler<std::decay_t<T>>(std::forward<T>(callback));
 }
 
 /**
@@ -84,15 +147,8 @@ auto scope_exit(T callback) {
  * \return scope_handler which does the execution in its destructor
  */
 template<class T>
-auto scope_failure(T callback) {
-	auto call = [callback]() {
-		if (std::uncaught_exception()) {
-			callback();
-		}
-		//else simply do nothing
-		};
-
-	return scope_handler<decltype(call)>(std::move(call));
+auto scope_failure(T&& callback) {
+	return scope_handler<std::decay_t<T>, detail::on_failure>(std::forward<T>(callback));
 }
 
 /**
@@ -101,15 +157,8 @@ auto scope_failure(T callback) {
  * \return scope_handler which does the execution in its destructor
  */
 template<class T>
-auto scope_success(T callback) {
-	auto call = [callback]() {
-		if (!std::uncaught_exception()) {
-			callback();
-		}
-		//do nothing in error case
-		};
-
-	return scope_handler<decltype(call)>(std::move(call));
+auto scope_success(T&& callback) {
+	return scope_handler<std::decay_t<T>, detail::on_success>(std::forward<T>(callback));
 }
 
 #endif /* BUBBLES_SCOPE_EXIT_HPP_ */
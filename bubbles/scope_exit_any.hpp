@@ -0,0 +1,312 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Caspar Kielwein
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef BUBBLES_SCOPE_EXIT_ANY_HPP_
+#define BUBBLES_SCOPE_EXIT_ANY_HPP_
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/*
+ * scope_exit_any and defer_stack are type erased relatives of scope_exit.
+ *
+ * scope_exit_any can be stored as a class member or in a container without
+ * naming the type of the callback.
+ * Unlike std::function it never allocates, the callback is stored
+ * in a fixed size buffer inside the object.
+ *
+ * defer_stack collects any number of callbacks in a single growing buffer
+ * and executes them in reverse order of registration,
+ * just like a sequence of scope_exit in a single scope would.
+ *
+ * Callbacks are executed from destructors and thus should not throw.
+ */
+
+namespace detail {
+
+/// type erased operations on a callback stored in raw memory
+struct callback_ops {
+	void (*call)(void* c) noexcept;
+	void (*move)(void* from, void* to) noexcept;
+	void (*destroy)(void* c) noexcept;
+	std::size_t size;
+};
+
+template<class Callback>
+struct callback_ops_for {
+	static void call(void* c) noexcept {
+		(*static_cast<Callback*>(c))();
+	}
+	static void move(void* from, void* to) noexcept {
+		::new (to) Callback(std::move(*static_cast<Callback*>(from)));
+	}
+	static void destroy(void* c) noexcept {
+		static_cast<Callback*>(c)->~Callback();
+	}
+	static constexpr callback_ops ops { &call, &move, &destroy, sizeof(Callback) };
+};
+
+template<class Callback>
+constexpr callback_ops callback_ops_for<Callback>::ops;
+
+template<class Callback>
+void check_erased_callback() {
+	static_assert(alignof(Callback) <= alignof(std::max_align_t),
+			"over aligned callbacks are not supported");
+	static_assert(std::is_nothrow_move_constructible<Callback>::value,
+			"callback needs to be nothrow move constructible");
+}
+
+constexpr std::size_t align_up(std::size_t n) {
+	return (n + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+}
+
+} // namespace detail
+
+/**
+ * \brief type erased scope_exit with inline storage for the callback
+ *
+ * \tparam Capacity size of the internal buffer in bytes.
+ * Callbacks, which don't fit, are rejected at compile time.
+ *
+ * ~~~{.cpp}
+ * struct transaction {
+ *     scope_exit_any rollback;
+ * };
+ * transaction t { [&] { undo(); } };
+ * ~~~
+ */
+template<std::size_t Capacity>
+class basic_scope_exit_any {
+public:
+	/// empty handler, which executes nothing
+	basic_scope_exit_any() noexcept = default;
+
+	template<class C, class = std::enable_if_t<!std::is_same<std::decay_t<C>, basic_scope_exit_any>::value>>
+	basic_scope_exit_any(C&& callback) noexcept(std::is_nothrow_constructible<std::decay_t<C>, C>::value) {
+		using Callback = std::decay_t<C>;
+		static_assert(sizeof(Callback) <= Capacity,
+				"callback is too large for the inline storage of scope_exit_any");
+		detail::check_erased_callback<Callback>();
+		::new (static_cast<void*>(buffer)) Callback(std::forward<C>(callback));
+		ops = &detail::callback_ops_for<Callback>::ops;
+	}
+
+	basic_scope_exit_any(basic_scope_exit_any&& other) noexcept {
+		take(other);
+	}
+
+	basic_scope_exit_any& operator=(basic_scope_exit_any&& other) noexcept {
+		if (this != &other) {
+			execute();
+			take(other);
+		}
+		return *this;
+	}
+
+	basic_scope_exit_any(const basic_scope_exit_any&) = delete;
+	basic_scope_exit_any& operator=(const basic_scope_exit_any&) = delete;
+
+	~basic_scope_exit_any() {
+		execute();
+	}
+
+	/// dismisses the handler, the callback will not be executed.
+	void release() noexcept {
+		if (ops) {
+			ops->destroy(buffer);
+			ops = nullptr;
+		}
+	}
+
+	/// true if a callback will be executed on destruction
+	explicit operator bool() const noexcept {
+		return ops != nullptr;
+	}
+
+private:
+	void execute() noexcept {
+		if (ops) {
+			ops->call(buffer);
+			release();
+		}
+	}
+
+	void take(basic_scope_exit_any& other) noexcept {
+		if (other.ops) {
+			other.ops->move(other.buffer, buffer);
+			ops = other.ops;
+			other.release();
+		}
+	}
+
+	const detail::callback_ops* ops = nullptr;
+	alignas(std::max_align_t) unsigned char buffer[Capacity];
+};
+
+/// scope_exit_any with room for callbacks capturing up to four pointers
+using scope_exit_any = basic_scope_exit_any<4 * sizeof(void*)>;
+
+/**
+ * \brief executes registered callbacks in LIFO order on destruction
+ *
+ * All callbacks are stored in one contiguous buffer, which grows geometrically.
+ * Once the buffer is large enough, registering a callback does not allocate.
+ * ~~~{.cpp}
+ * defer_stack rollback;
+ * rollback.push([&] { undo_insert(); });
+ * rollback.push([&] { undo_update(); });
+ * ...
+ * rollback.release(); //commit, nothing is undone
+ * ~~~
+ */
+class defer_stack {
+public:
+	defer_stack() noexcept = default;
+
+	/// reserves \p bytes of storage for callbacks
+	explicit defer_stack(std::size_t bytes) {
+		reserve(bytes);
+	}
+
+	defer_stack(defer_stack&& other) noexcept :
+			storage(std::move(other.storage)), capacity(other.capacity), used(other.used), last(other.last) {
+		other.capacity = 0;
+		other.used = 0;
+	}
+
+	defer_stack(const defer_stack&) = delete;
+	defer_stack& operator=(const defer_stack&) = delete;
+	defer_stack& operator=(defer_stack&&) = delete;
+
+	~defer_stack() {
+		run();
+	}
+
+	/// registers a callback, which is executed before all previously registered callbacks.
+	template<class C>
+	void push(C&& callback) {
+		using Callback = std::decay_t<C>;
+		detail::check_erased_callback<Callback>();
+
+		const auto entry_size = detail::align_up(header_size + sizeof(Callback));
+		if (used + entry_size > capacity)
+			grow(used + entry_size);
+
+		auto* entry = storage.get() + used;
+		::new (static_cast<void*>(entry + header_size)) Callback(std::forward<C>(callback));
+		::new (static_cast<void*>(entry)) header { &detail::callback_ops_for<Callback>::ops, last };
+		last = used;
+		used += entry_size;
+	}
+
+	/// executes all callbacks in LIFO order, the stack is empty afterwards.
+	void run() noexcept {
+		while (used != 0) {
+			auto* entry = storage.get() + last;
+			const auto h = *reinterpret_cast<header*>(entry);
+			h.ops->call(entry + header_size);
+			h.ops->destroy(entry + header_size);
+			used = last;
+			last = h.previous;
+		}
+	}
+
+	/// drops all callbacks without executing them
+	void release() noexcept {
+		for_each_entry([](const header& h, unsigned char* callback) {
+			h.ops->destroy(callback);
+		});
+		used = 0;
+	}
+
+	/// ensures storage for at least \p bytes of callbacks, including bookkeeping
+	void reserve(std::size_t bytes) {
+		if (bytes > capacity)
+			grow(bytes);
+	}
+
+	bool empty() const noexcept {
+		return used == 0;
+	}
+
+private:
+	struct header {
+		const detail::callback_ops* ops;
+		std::size_t previous;
+	};
+	static constexpr std::size_t header_size = detail::align_up(sizeof(header));
+
+	template<class F>
+	void for_each_entry(F f) noexcept {
+		for (std::size_t offset = 0; offset != used;) {
+			auto* entry = storage.get() + offset;
+			const auto& h = *reinterpret_cast<header*>(entry);
+			f(h, entry + header_size);
+			offset += detail::align_up(header_size + h.ops->size);
+		}
+	}
+
+	void grow(std::size_t min_capacity) {
+		auto new_capacity = capacity == 0 ? std::size_t { 256 } : capacity;
+		while (new_capacity < min_capacity)
+			new_capacity *= 2;
+
+		auto new_storage = allocate(new_capacity);
+		for_each_entry([&](const header& h, unsigned char* callback) {
+			auto* to = new_storage.get() + (callback - storage.get());
+			::new (static_cast<void*>(to - header_size)) header(h);
+			h.ops->move(callback, to);
+			h.ops->destroy(callback);
+		});
+		storage = std::move(new_storage);
+		capacity = new_capacity;
+	}
+
+	struct deallocate {
+		void operator()(unsigned char* p) const noexcept {
+			::operator delete(p);
+		}
+	};
+	using storage_ptr = std::unique_ptr<unsigned char, deallocate>;
+
+	static storage_ptr allocate(std::size_t bytes) {
+		//operator new returns memory suitably aligned for std::max_align_t
+		return storage_ptr { static_cast<unsigned char*>(::operator new(bytes)) };
+	}
+
+	storage_ptr storage;
+	std::size_t capacity = 0;
+	std::size_t used = 0;
+	std::size_t last = 0;
+};
+
+#endif /* BUBBLES_SCOPE_EXIT_ANY_HPP_ */
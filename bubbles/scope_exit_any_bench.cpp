@@ -0,0 +1,92 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Caspar Kielwein
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "scope_exit_any.hpp"
+#include "benchmark.hpp"
+
+#include <functional>
+#include <vector>
+
+/*
+ * Registers a few dozen rollback actions per "request", like transaction code does,
+ * and executes them in reverse order.
+ * Compares defer_stack with a std::vector<std::function<void()>>.
+ */
+
+namespace {
+
+constexpr long actions = 32;
+long total = 0;
+
+struct rollback_action {
+	long* total;
+	long row;
+	long column;
+	void operator()() const noexcept {
+		*total += row * column;
+	}
+};
+
+BENCHMARK("std::vector<std::function<void()>>, 32 actions", [] {
+	std::vector<std::function<void()>> rollback;
+	for (long i = 0; i < actions; ++i)
+		rollback.emplace_back(rollback_action { &total, 1, i });
+	for (auto it = rollback.rbegin(); it != rollback.rend(); ++it)
+		(*it)();
+	do_not_optimize(total);
+});
+
+BENCHMARK("defer_stack, 32 actions", [] {
+	defer_stack rollback;
+	for (long i = 0; i < actions; ++i)
+		rollback.push(rollback_action { &total, 1, i });
+	rollback.run();
+	do_not_optimize(total);
+});
+
+defer_stack reused;
+
+BENCHMARK("defer_stack reused, 32 actions", [] {
+	for (long i = 0; i < actions; ++i)
+		reused.push(rollback_action { &total, 1, i });
+	reused.run();
+	do_not_optimize(total);
+});
+
+BENCHMARK("std::function guard", [] {
+	std::function<void()> guard { rollback_action { &total, 1, 2 } };
+	guard();
+	do_not_optimize(total);
+});
+
+BENCHMARK("scope_exit_any", [] {
+	scope_exit_any guard { rollback_action { &total, 1, 2 } };
+	clobber_memory();
+});
+
+} // namespace
@@ -0,0 +1,120 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Caspar Kielwein
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "scope_exit_any.hpp"
+
+#include <array>
+#include <cassert>
+#include <memory>
+#include <vector>
+
+struct member_guard {
+	scope_exit_any on_destruction;
+};
+
+int main() {
+	int calls = 0;
+
+	{
+		scope_exit_any guard { [&] { ++calls; } };
+		assert(guard);
+	}
+	assert(calls == 1);
+
+	{
+		scope_exit_any guard { [&] { ++calls; } };
+		guard.release();
+		assert(!guard);
+	}
+	assert(calls == 1);
+
+	{
+		member_guard m { [&] { ++calls; } };
+		std::vector<scope_exit_any> guards;
+		for (int i = 0; i < 10; ++i)
+			guards.emplace_back([&] { ++calls; });
+		assert(calls == 1); //moving guards around does not execute them
+	}
+	assert(calls == 12);
+
+	{
+		scope_exit_any a { [&] { calls += 10; } };
+		a = scope_exit_any { [&] { calls += 100; } }; //executes the replaced callback
+		assert(calls == 22);
+	}
+	assert(calls == 122);
+
+	//callbacks with non trivial captures are destroyed correctly
+	auto shared = std::make_shared<int>(0);
+	{
+		scope_exit_any guard { [shared] { ++*shared; } };
+		assert(shared.use_count() == 2);
+	}
+	assert(*shared == 1);
+	assert(shared.use_count() == 1);
+
+	std::vector<int> order;
+	{
+		defer_stack stack;
+		for (int i = 0; i < 100; ++i)
+			stack.push([&order, i] { order.push_back(i); });
+
+		//larger callbacks can be mixed with small ones and force reallocation
+		std::array<char, 300> big { };
+		big[0] = 1;
+		stack.push([&order, big] { order.push_back(1000 + big[0]); });
+		stack.push([shared] { ++*shared; });
+	}
+	assert(order.size() == 101);
+	assert(order.front() == 1001);
+	assert(order[1] == 99);
+	assert(order.back() == 0);
+	assert(*shared == 2);
+	assert(shared.use_count() == 1);
+
+	{
+		defer_stack stack;
+		stack.push([shared] { ++*shared; });
+		assert(shared.use_count() == 2);
+		stack.release();
+		assert(stack.empty());
+		assert(shared.use_count() == 1);
+	}
+	assert(*shared == 2);
+
+	{
+		defer_stack stack;
+		stack.push([&] { ++calls; });
+		stack.run();
+		assert(calls == 123);
+		stack.push([&] { ++calls; });
+	}
+	assert(calls == 124);
+
+	return 0;
+}
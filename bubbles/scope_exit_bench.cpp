@@ -0,0 +1,90 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Caspar Kielwein
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "scope_exit.hpp"
+#include "benchmark.hpp"
+
+/*
+ * Compares scope guards with a hand written call at the end of the scope.
+ *
+ * To compare the generated code, compile with
+ * g++ -std=c++17 -O2 -S scope_exit_bench.cpp
+ * guarded and hand_written compile to the same instructions
+ * on the non throwing path, since the callback is noexcept.
+ */
+
+namespace {
+
+volatile int sink = 0;
+int counter = 0;
+
+BENCHMARK_NOINLINE void work(int i) noexcept {
+	sink = i;
+}
+
+BENCHMARK_NOINLINE void cleanup(int* c) noexcept {
+	++*c;
+}
+
+BENCHMARK_NOINLINE void hand_written(int i, int* c) {
+	work(i);
+	cleanup(c);
+}
+
+BENCHMARK_NOINLINE void guarded(int i, int* c) {
+	auto guard = scope_exit([c]() noexcept { cleanup(c); });
+	work(i);
+}
+
+BENCHMARK_NOINLINE void guarded_success(int i, int* c) {
+	auto guard = scope_success([c]() noexcept { cleanup(c); });
+	work(i);
+}
+
+BENCHMARK_NOINLINE void guarded_failure(int i, int* c) {
+	auto guard = scope_failure([c]() noexcept { cleanup(c); });
+	work(i);
+}
+
+BENCHMARK("hand written cleanup", [] {
+	hand_written(1, &counter);
+});
+
+BENCHMARK("scope_exit", [] {
+	guarded(1, &counter);
+});
+
+BENCHMARK("scope_success", [] {
+	guarded_success(1, &counter);
+});
+
+BENCHMARK("scope_failure", [] {
+	guarded_failure(1, &counter);
+});
+
+} // namespace
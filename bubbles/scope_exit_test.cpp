@@ -0,0 +1,122 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Caspar Kielwein
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "scope_exit.hpp"
+
+#include <cassert>
+#include <stdexcept>
+#include <type_traits>
+
+/// counts copies of the callback, there should be none.
+struct counting_callback {
+	int* calls;
+	int* copies;
+
+	counting_callback(int* calls, int* copies) :
+			calls(calls), copies(copies) {
+	}
+	counting_callback(const counting_callback& o) :
+			calls(o.calls), copies(o.copies) {
+		++*copies;
+	}
+	counting_callback(counting_callback&&) = default;
+
+	void operator()() const noexcept {
+		++*calls;
+	}
+};
+
+/// uses scope_failure in a destructor, which is called during stack unwinding
+struct rollback_on_destruction {
+	int* failures;
+	~rollback_on_destruction() {
+		auto guard = scope_failure([this] { ++*failures; });
+		//the destructor itself is left without a new exception
+	}
+};
+
+int main() {
+	int calls = 0;
+	int copies = 0;
+
+	{
+		auto guard = scope_exit(counting_callback { &calls, &copies });
+	}
+	assert(calls == 1);
+	assert(copies == 0);
+
+	{
+		auto guard = scope_exit([&] { ++calls; });
+		guard.release();
+	}
+	assert(calls == 1);
+
+	{
+		auto guard = scope_exit([&] { ++calls; });
+		auto moved = std::move(guard); //only moved executes
+	}
+	assert(calls == 2);
+
+	int failures = 0;
+	int successes = 0;
+	try {
+		auto fail = scope_failure([&] { ++failures; });
+		auto success = scope_success([&] { ++successes; });
+		throw std::runtime_error("test");
+	} catch (const std::runtime_error&) {
+	}
+	assert(failures == 1);
+	assert(successes == 0);
+
+	{
+		auto fail = scope_failure([&] { ++failures; });
+		auto success = scope_success([&] { ++successes; });
+	}
+	assert(failures == 1);
+	assert(successes == 1);
+
+	int nested_failures = 0;
+	try {
+		rollback_on_destruction r { &nested_failures };
+		throw std::runtime_error("test");
+	} catch (const std::runtime_error&) {
+	}
+#if __cpp_lib_uncaught_exceptions
+	assert(nested_failures == 0);
+#endif
+
+	auto nothrow_guard = scope_exit([]() noexcept {});
+	static_assert(std::is_nothrow_destructible<decltype(nothrow_guard)>::value,
+			"scope_handler with noexcept callback needs to be noexcept");
+	static_assert(std::is_nothrow_move_constructible<decltype(nothrow_guard)>::value,
+			"scope_handler with noexcept callback needs to be noexcept");
+	static_assert(!std::is_copy_constructible<decltype(nothrow_guard)>::value,
+			"scope_handler must not be copyable");
+
+	return 0;
+}
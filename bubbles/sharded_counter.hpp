@@ -0,0 +1,179 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Caspar Kielwein
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef BUBBLES_SHARDED_COUNTER_HPP_
+#define BUBBLES_SHARDED_COUNTER_HPP_
+
+#include "prettyprint.hpp"
+#include "thread_index.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace detail {
+
+/// size of a cache line on all platforms we care about.
+constexpr std::size_t counter_cache_line() {
+	return 64;
+}
+
+} // namespace detail
+
+/**
+ * \brief counter for hot paths, which avoids cache line ping-pong between threads.
+ *
+ * Each thread increments its own slot, which lives on its own cache line.
+ * Thus an increment is a plain load and store, without an atomic read-modify-write.
+ * Reading the counter sums up all slots and is correspondingly slower.
+ *
+ * Threads are assigned slots by a small thread index, which is reused after a thread exits.
+ * If there are more running threads than slots, the additional threads share
+ * one overflow slot and fall back to atomic increments.
+ *
+ * \tparam T value type, unsigned for counters, signed for gauges
+ * \author ckielwein
+ */
+template<class T>
+class basic_sharded_counter {
+public:
+	/// \param slots number of slots, at least the number of threads which increment concurrently
+	explicit basic_sharded_counter(std::size_t slots = 64) :
+			slot_count(slots), values(new slot[slots + 1]) {
+	}
+
+	/// adds \p n to the counter
+	void add(T n = 1) noexcept {
+		const auto index = thread_index();
+		if (index < slot_count) {
+			//only this thread writes to the slot
+			auto& v = values[index].value;
+			v.store(v.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+		} else {
+			values[slot_count].value.fetch_add(n, std::memory_order_relaxed);
+		}
+	}
+
+	/// subtracts \p n from the counter, mostly useful for gauges.
+	void sub(T n = 1) noexcept {
+		add(static_cast<T>(0 - n));
+	}
+
+	basic_sharded_counter& operator++() noexcept {
+		add();
+		return *this;
+	}
+
+	/// sum of all slots, concurrent increments might be missing.
+	T read() const noexcept {
+		T sum = 0;
+		for (std::size_t i = 0; i <= slot_count; ++i)
+			sum += values[i].value.load(std::memory_order_relaxed);
+		return sum;
+	}
+
+private:
+	//padding instead of alignas, so no over-aligned new is needed before C++17.
+	//Values of neighboring slots are still a cache line apart.
+	struct slot {
+		std::atomic<T> value { 0 };
+		char padding[detail::counter_cache_line() - sizeof(std::atomic<T>)];
+	};
+
+	std::size_t slot_count;
+	std::unique_ptr<slot[]> values; //slot_count exclusive slots and one shared overflow slot
+};
+
+/// monotonic counter, e.g. number of requests
+using sharded_counter = basic_sharded_counter<std::uint64_t>;
+/// value which goes up and down, e.g. number of open connections
+using sharded_gauge = basic_sharded_counter<std::int64_t>;
+
+/**
+ * \brief named counters and gauges, which can be dumped together.
+ *
+ * Counters are created on first access and live as long as the registry.
+ * Lookup takes a lock, keep the returned reference for hot paths:
+ * ~~~{.cpp}
+ * metrics_registry metrics;
+ * auto& requests = metrics.counter("requests");
+ * ++requests; //hot path
+ * metrics.dump(); //prints [<requests, 1>, ...]
+ * ~~~
+ */
+class metrics_registry {
+public:
+	sharded_counter& counter(const std::string& name) {
+		return get(counters, name);
+	}
+
+	sharded_gauge& gauge(const std::string& name) {
+		return get(gauges, name);
+	}
+
+	/// current values of all counters and gauges, sorted by name
+	std::vector<std::pair<std::string, std::int64_t>> snapshot() const {
+		std::lock_guard<std::mutex> lock { mutex };
+		std::vector<std::pair<std::string, std::int64_t>> result;
+		for (const auto& c : counters)
+			result.emplace_back(c.first, static_cast<std::int64_t>(c.second->read()));
+		for (const auto& g : gauges)
+			result.emplace_back(g.first, g.second->read());
+		std::sort(result.begin(), result.end());
+		return result;
+	}
+
+	/// prints all counters and gauges with print_range
+	void dump() const {
+		print_range(snapshot());
+	}
+
+private:
+	template<class Map>
+	typename Map::mapped_type::element_type& get(Map& map, const std::string& name) {
+		std::lock_guard<std::mutex> lock { mutex };
+		auto& c = map[name];
+		if (!c)
+			c.reset(new typename Map::mapped_type::element_type { });
+		return *c;
+	}
+
+	mutable std::mutex mutex;
+	std::map<std::string, std::unique_ptr<sharded_counter>> counters;
+	std::map<std::string, std::unique_ptr<sharded_gauge>> gauges;
+};
+
+#endif /* BUBBLES_SHARDED_COUNTER_HPP_ */
@@ -0,0 +1,87 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Caspar Kielwein
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "sharded_counter.hpp"
+#include "benchmark.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+/*
+ * Increment throughput of a sharded_counter compared to a single std::atomic,
+ * with 1 to 64 threads incrementing concurrently.
+ * Each iteration is one increment on every thread.
+ */
+
+namespace {
+
+template<class Increment>
+void on_threads(int threads, std::size_t iterations, Increment increment) {
+	std::vector<std::thread> workers;
+	for (int t = 0; t < threads; ++t) {
+		workers.emplace_back([&] {
+			for (std::size_t i = 0; i < iterations; ++i)
+				increment();
+		});
+	}
+	for (auto& w : workers)
+		w.join();
+}
+
+std::atomic<std::uint64_t> single { 0 };
+sharded_counter sharded;
+
+bool register_thread_count(int threads) {
+	const auto suffix = ", " + std::to_string(threads) + " threads";
+	register_benchmark("std::atomic fetch_add" + suffix, [threads](std::size_t iterations) {
+		on_threads(threads, iterations, [] { single.fetch_add(1, std::memory_order_relaxed); });
+	});
+	register_benchmark("sharded_counter" + suffix, [threads](std::size_t iterations) {
+		on_threads(threads, iterations, [] { ++sharded; });
+	});
+	return true;
+}
+
+const bool thread_counts[] = {
+	register_thread_count(1),
+	register_thread_count(2),
+	register_thread_count(4),
+	register_thread_count(8),
+	register_thread_count(16),
+	register_thread_count(32),
+	register_thread_count(64),
+};
+
+BENCHMARK("sharded_counter read", [] {
+	do_not_optimize(sharded.read());
+});
+
+} // namespace
@@ -0,0 +1,77 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Caspar Kielwein
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "sharded_counter.hpp"
+
+#include <cassert>
+#include <thread>
+#include <vector>
+
+int main() {
+	sharded_counter counter;
+	++counter;
+	counter.add(41);
+	assert(counter.read() == 42);
+
+	sharded_gauge gauge;
+	gauge.add(5);
+	gauge.sub(7);
+	assert(gauge.read() == -2);
+
+	//more threads than slots share the overflow slot
+	constexpr int threads = 8;
+	constexpr int increments = 100000;
+	sharded_counter few_slots { 2 };
+	std::vector<std::thread> workers;
+	for (int t = 0; t < threads; ++t) {
+		workers.emplace_back([&] {
+			for (int i = 0; i < increments; ++i) {
+				++counter;
+				++few_slots;
+			}
+		});
+	}
+	for (auto& w : workers)
+		w.join();
+	assert(counter.read() == 42 + threads * increments);
+	assert(few_slots.read() == threads * increments);
+
+	metrics_registry metrics;
+	auto& requests = metrics.counter("requests");
+	requests.add(3);
+	metrics.gauge("connections").add(2);
+	assert(&metrics.counter("requests") == &requests);
+
+	const auto snapshot = metrics.snapshot();
+	assert(snapshot.size() == 2);
+	assert(snapshot[0].first == "connections" && snapshot[0].second == 2);
+	assert(snapshot[1].first == "requests" && snapshot[1].second == 3);
+	metrics.dump();
+
+	return 0;
+}
@@ -0,0 +1,341 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Caspar Kielwein
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef BUBBLES_SMALL_VECTOR_HPP_
+#define BUBBLES_SMALL_VECTOR_HPP_
+
+#include "power_of_two.hpp"
+#include "safe_cstring.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/**
+ * \brief vector with inline storage for the first N elements.
+ *
+ * small_vector stores up to N elements inside the object itself, without any allocation.
+ * Only if more elements are added, the elements move to the heap.
+ * The capacity of the heap storage is always a power of two.
+ *
+ * Trivially copyable elements are relocated with a single memcpy,
+ * instead of moving and destroying them one by one.
+ *
+ * small_vector works with make_range and print_range.
+ * ~~~{.cpp}
+ * small_vector<int, 16> v { 1, 2, 3 };
+ * v.push_back(4); //no allocation
+ * print_range(v);
+ * ~~~
+ *
+ * \tparam T element type
+ * \tparam N number of elements stored inline
+ * \author ckielwein
+ */
+template<class T, std::size_t N>
+class small_vector {
+	static_assert(N > 0, "small_vector needs inline storage for at least one element");
+
+public:
+	using value_type = T;
+	using size_type = std::size_t;
+	using difference_type = std::ptrdiff_t;
+	using reference = T&;
+	using const_reference = const T&;
+	using pointer = T*;
+	using const_pointer = const T*;
+	using iterator = T*;
+	using const_iterator = const T*;
+
+	small_vector() noexcept = default;
+
+	small_vector(std::initializer_list<T> values) {
+		reserve(values.size());
+		for (const auto& v : values)
+			emplace_back(v);
+	}
+
+	small_vector(const small_vector& other) {
+		reserve(other.size());
+		for (const auto& v : other)
+			emplace_back(v);
+	}
+
+	small_vector(small_vector&& other) noexcept(std::is_nothrow_move_constructible<T>::value) {
+		take(other);
+	}
+
+	small_vector& operator=(const small_vector& other) {
+		if (this != &other) {
+			clear();
+			reserve(other.size());
+			for (const auto& v : other)
+				emplace_back(v);
+		}
+		return *this;
+	}
+
+	small_vector& operator=(small_vector&& other) noexcept(std::is_nothrow_move_constructible<T>::value) {
+		if (this != &other) {
+			clear();
+			deallocate();
+			take(other);
+		}
+		return *this;
+	}
+
+	~small_vector() {
+		clear();
+		deallocate();
+	}
+
+	template<class... Args>
+	T& emplace_back(Args&&... args) {
+		if (size_ == capacity_) {
+			//construct first, args might refer to an element of this vector
+			T value(std::forward<Args>(args)...);
+			grow(size_ + 1);
+			::new (static_cast<void*>(data_ + size_)) T(std::move(value));
+		} else {
+			::new (static_cast<void*>(data_ + size_)) T(std::forward<Args>(args)...);
+		}
+		return data_[size_++];
+	}
+
+	void push_back(const T& value) {
+		emplace_back(value);
+	}
+
+	void push_back(T&& value) {
+		emplace_back(std::move(value));
+	}
+
+	void pop_back() {
+		assert(!empty());
+		data_[--size_].~T();
+	}
+
+	/// ensures capacity for at least \p n elements, the capacity is rounded to a power of two
+	void reserve(std::size_t n) {
+		if (n > capacity_)
+			grow(n);
+	}
+
+	/// resizes to \p n elements, new elements are value initialized
+	void resize(std::size_t n) {
+		reserve(n);
+		while (size_ < n)
+			emplace_back();
+		while (size_ > n)
+			pop_back();
+	}
+
+	void clear() noexcept {
+		destroy(data_, data_ + size_);
+		size_ = 0;
+	}
+
+	T& operator[](std::size_t i) {
+		assert(i < size_);
+		return data_[i];
+	}
+
+	const T& operator[](std::size_t i) const {
+		assert(i < size_);
+		return data_[i];
+	}
+
+	T& back() {
+		assert(!empty());
+		return data_[size_ - 1];
+	}
+
+	const T& back() const {
+		assert(!empty());
+		return data_[size_ - 1];
+	}
+
+	T* data() noexcept {
+		return data_;
+	}
+	const T* data() const noexcept {
+		return data_;
+	}
+
+	iterator begin() noexcept {
+		return data_;
+	}
+	iterator end() noexcept {
+		return data_ + size_;
+	}
+	const_iterator begin() const noexcept {
+		return data_;
+	}
+	const_iterator end() const noexcept {
+		return data_ + size_;
+	}
+
+	std::size_t size() const noexcept {
+		return size_;
+	}
+	std::size_t capacity() const noexcept {
+		return capacity_;
+	}
+	bool empty() const noexcept {
+		return size_ == 0;
+	}
+
+	/// true while the elements are stored inside the object
+	bool is_inline() const noexcept {
+		return data_ == inline_data();
+	}
+
+private:
+	T* inline_data() noexcept {
+		return reinterpret_cast<T*>(buffer);
+	}
+	const T* inline_data() const noexcept {
+		return reinterpret_cast<const T*>(buffer);
+	}
+
+	/// moves \p count elements to uninitialized memory at \p to and destroys the originals
+	static void relocate(T* from, std::size_t count, T* to, std::true_type /*trivially copyable*/) noexcept {
+		safe_copy_n(to, from, count);
+	}
+
+	static void relocate(T* from, std::size_t count, T* to, std::false_type /*trivially copyable*/) {
+		std::size_t i = 0;
+		try {
+			for (; i < count; ++i)
+				::new (static_cast<void*>(to + i)) T(std::move_if_noexcept(from[i]));
+		} catch (...) {
+			destroy(to, to + i);
+			throw;
+		}
+		destroy(from, from + count);
+	}
+
+	static void destroy(T* first, T* last) noexcept {
+		for (; first != last; ++first)
+			first->~T();
+	}
+
+	/// heap storage for \p n elements, which respects the alignment of over-aligned T
+	static T* allocate_heap(std::size_t n) {
+#ifdef __cpp_aligned_new
+		if (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+			return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t { alignof(T) }));
+#else
+		static_assert(alignof(T) <= alignof(std::max_align_t), "over-aligned elements need C++17 aligned new");
+#endif
+		return static_cast<T*>(::operator new(n * sizeof(T)));
+	}
+
+	static void free_heap(T* p) noexcept {
+#ifdef __cpp_aligned_new
+		if (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+			::operator delete(p, std::align_val_t { alignof(T) });
+			return;
+		}
+#endif
+		::operator delete(p);
+	}
+
+	void grow(std::size_t min_capacity) {
+		const auto new_capacity = next_power_of_two(std::max(min_capacity, capacity_ + 1));
+		auto* new_data = allocate_heap(new_capacity);
+		try {
+			relocate(data_, size_, new_data, std::is_trivially_copyable<T> { });
+		} catch (...) {
+			free_heap(new_data);
+			throw;
+		}
+		deallocate();
+		data_ = new_data;
+		capacity_ = new_capacity;
+	}
+
+	void deallocate() noexcept {
+		if (!is_inline())
+			free_heap(data_);
+		data_ = inline_data();
+		capacity_ = N;
+	}
+
+	/// takes the elements of other, other is empty afterwards
+	void take(small_vector& other) {
+		if (other.is_inline()) {
+			relocate(other.data_, other.size_, data_, std::is_trivially_copyable<T> { });
+		} else {
+			data_ = other.data_;
+			capacity_ = other.capacity_;
+			other.data_ = other.inline_data();
+			other.capacity_ = N;
+		}
+		size_ = other.size_;
+		other.size_ = 0;
+	}
+
+	alignas(T) unsigned char buffer[N * sizeof(T)];
+	T* data_ = inline_data();
+	std::size_t size_ = 0;
+	std::size_t capacity_ = N;
+};
+
+template<class T, std::size_t N>
+auto begin(small_vector<T, N>& v) {
+	return v.begin();
+}
+
+template<class T, std::size_t N>
+auto end(small_vector<T, N>& v) {
+	return v.end();
+}
+
+template<class T, std::size_t N>
+auto begin(const small_vector<T, N>& v) {
+	return v.begin();
+}
+
+template<class T, std::size_t N>
+auto end(const small_vector<T, N>& v) {
+	return v.end();
+}
+
+template<class T, std::size_t N>
+bool operator==(const small_vector<T, N>& l, const small_vector<T, N>& r) {
+	return l.size() == r.size() && std::equal(l.begin(), l.end(), r.begin());
+}
+
+#endif /* BUBBLES_SMALL_VECTOR_HPP_ */
@@ -0,0 +1,85 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Caspar Kielwein
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "small_vector.hpp"
+#include "benchmark.hpp"
+
+#include <string>
+#include <vector>
+
+/*
+ * Creates a vector, pushes elements, iterates over them and destroys the vector.
+ * Compares small_vector<T, 16> with std::vector<T>,
+ * for sizes within the inline storage and far beyond it.
+ */
+
+namespace {
+
+template<class Vector>
+void push_iterate_destroy(int count) {
+	Vector v;
+	for (int i = 0; i < count; ++i)
+		v.push_back(i);
+	int sum = 0;
+	for (auto x : v)
+		sum += x;
+	do_not_optimize(sum);
+}
+
+template<class Vector>
+void strings(int count) {
+	Vector v;
+	for (int i = 0; i < count; ++i)
+		v.push_back("a string, which is too long for the small string optimization");
+	do_not_optimize(v.data());
+}
+
+bool register_size(int count) {
+	const auto suffix = ", " + std::to_string(count) + " elements";
+	register_benchmark("std::vector<int>" + suffix, [count] {
+		push_iterate_destroy<std::vector<int>>(count);
+	});
+	register_benchmark("small_vector<int, 16>" + suffix, [count] {
+		push_iterate_destroy<small_vector<int, 16>>(count);
+	});
+	register_benchmark("std::vector<std::string>" + suffix, [count] {
+		strings<std::vector<std::string>>(count);
+	});
+	register_benchmark("small_vector<std::string, 16>" + suffix, [count] {
+		strings<small_vector<std::string, 16>>(count);
+	});
+	return true;
+}
+
+const bool sizes[] = {
+	register_size(8),
+	register_size(16),
+	register_size(1000),
+};
+
+} // namespace
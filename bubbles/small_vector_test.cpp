@@ -0,0 +1,120 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Caspar Kielwein
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "small_vector.hpp"
+#include "pair_range.hpp"
+#include "prettyprint.hpp"
+
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#ifdef __cpp_aligned_new
+struct alignas(64) cache_line {
+	int value;
+};
+#endif
+
+int main() {
+	small_vector<int, 4> v;
+	assert(v.empty());
+	assert(v.is_inline());
+	assert(v.capacity() == 4);
+
+	for (int i = 0; i < 4; ++i)
+		v.push_back(i);
+	assert(v.is_inline());
+
+	v.push_back(4);
+	assert(!v.is_inline());
+	assert(is_power_of_two(v.capacity()));
+	assert(v.size() == 5);
+	assert(v[4] == 4 && v[0] == 0);
+
+	//inserting an element of the vector itself during reallocation
+	small_vector<int, 2> self { 7, 8 };
+	self.push_back(self[0]);
+	assert(self[2] == 7);
+
+	v.reserve(100);
+	assert(v.capacity() == 128);
+
+	int sum = 0;
+	for (auto i : make_range(v.begin(), v.end()))
+		sum += i;
+	assert(sum == 10);
+	print_range(v);
+
+	//non trivially copyable elements are moved one by one
+	small_vector<std::string, 2> strings { "a", "b" };
+	strings.emplace_back(40, 'c');
+	assert(strings.size() == 3);
+	assert(strings[2] == std::string(40, 'c'));
+	print_range(strings);
+
+	auto copy = strings;
+	assert(copy == strings);
+	auto moved = std::move(copy);
+	assert(moved == strings);
+	assert(copy.empty());
+
+	small_vector<std::string, 4> inline_strings { "x", "y" };
+	auto moved_inline = std::move(inline_strings);
+	assert(moved_inline.is_inline());
+	assert(moved_inline[1] == "y");
+
+	//elements are destroyed
+	auto shared = std::make_shared<int>(1);
+	{
+		small_vector<std::shared_ptr<int>, 2> pointers;
+		for (int i = 0; i < 10; ++i)
+			pointers.push_back(shared);
+		assert(shared.use_count() == 11);
+		pointers.pop_back();
+		assert(shared.use_count() == 10);
+		pointers.resize(3);
+		assert(shared.use_count() == 4);
+	}
+	assert(shared.use_count() == 1);
+
+	small_vector<int, 2> empty;
+	print_range(empty);
+
+#ifdef __cpp_aligned_new
+	//over-aligned elements keep their alignment on the heap
+	small_vector<cache_line, 2> lines;
+	for (int i = 0; i < 10; ++i)
+		lines.push_back(cache_line { i });
+	assert(!lines.is_inline());
+	assert(reinterpret_cast<std::uintptr_t>(lines.data()) % alignof(cache_line) == 0);
+	assert(lines[9].value == 9);
+#endif
+
+	return 0;
+}
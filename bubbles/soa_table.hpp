@@ -0,0 +1,218 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Caspar Kielwein
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef BUBBLES_SOA_TABLE_HPP_
+#define BUBBLES_SOA_TABLE_HPP_
+
+#include "pair_range.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace detail {
+
+template<class T, class... List>
+struct count_type : std::integral_constant<std::size_t, 0> {
+};
+
+template<class T, class Head, class... Tail>
+struct count_type<T, Head, Tail...> : std::integral_constant<std::size_t,
+		std::is_same<T, Head>::value + count_type<T, Tail...>::value> {
+};
+
+/// evaluates a pack expansion in order, C++14 replacement for a fold expression
+using expand = int[];
+
+} // namespace detail
+
+/**
+ * \brief table of records stored as a struct of arrays.
+ *
+ * Each column is stored in its own contiguous array.
+ * Columns are identified by their type, which is usually a NamedValue:
+ * ~~~{.cpp}
+ * using Height = NamedValue<double, height_tag>;
+ * using Width = NamedValue<double, width_tag>;
+ * soa_table<Height, Width> table;
+ * table.push_back(Height{1.2}, Width{3.4});
+ * for (auto h : table.column<Height>())
+ *     ...
+ * ~~~
+ * Scanning a single column only touches the memory of that column,
+ * instead of the whole record as in a std::vector<struct>.
+ *
+ * \tparam Columns types of the columns, each type may only occur once
+ * \author ckielwein
+ */
+template<class... Columns>
+class soa_table {
+	static_assert(sizeof...(Columns) > 0, "soa_table needs at least one column");
+
+	template<class C>
+	using column_check = std::enable_if_t<detail::count_type<C, Columns...>::value == 1>;
+
+public:
+	/// proxy for a single row, allows access to all columns of that row
+	template<class Table>
+	class row_proxy {
+	public:
+		/// reference to the value of column C in this row
+		template<class C>
+		decltype(auto) get() const {
+			return table->template column<C>().begin()[index];
+		}
+
+	private:
+		friend class soa_table;
+		row_proxy(Table* table, std::size_t index) :
+				table(table), index(index) {
+		}
+		Table* table;
+		std::size_t index;
+	};
+
+	using row = row_proxy<soa_table>;
+	using const_row = row_proxy<const soa_table>;
+
+	/// contiguous range of a single column
+	template<class C, class = column_check<C>>
+	auto column() {
+		auto& c = std::get<std::vector<C>>(columns);
+		return make_range(c.data(), c.data() + c.size());
+	}
+
+	/// contiguous range of a single column
+	template<class C, class = column_check<C>>
+	auto column() const {
+		const auto& c = std::get<std::vector<C>>(columns);
+		return make_range(c.data(), c.data() + c.size());
+	}
+
+	row operator[](std::size_t index) {
+		assert(index < size());
+		return row { this, index };
+	}
+
+	const_row operator[](std::size_t index) const {
+		assert(index < size());
+		return const_row { this, index };
+	}
+
+	/// appends one row, values are given in the order of the columns
+	void push_back(Columns... values) {
+		const auto old_size = size();
+		try {
+			(void) detail::expand { 0, (std::get<std::vector<Columns>>(columns).push_back(std::move(values)), 0)... };
+		} catch (...) {
+			resize_all(old_size);
+			throw;
+		}
+	}
+
+	/**
+	 * \brief appends many rows at once
+	 * \param values one range per column, in the order of the columns
+	 * \throws std::invalid_argument if the ranges are not of equal size, the table is left unchanged
+	 */
+	template<class... Ranges>
+	void append(const Ranges&... values) {
+		static_assert(sizeof...(Ranges) == sizeof...(Columns), "append needs a range for each column");
+		const std::size_t lengths[] = { range_length(values)... };
+		for (auto l : lengths)
+			if (l != lengths[0])
+				throw std::invalid_argument("soa_table::append: ranges of different size");
+		const auto old_size = size();
+		try {
+			(void) detail::expand { 0, (append_column<Columns>(values), 0)... };
+		} catch (...) {
+			resize_all(old_size);
+			throw;
+		}
+		assert(consistent());
+	}
+
+	/// reserves space for \p rows rows in every column
+	void reserve(std::size_t rows) {
+		(void) detail::expand { 0, (std::get<std::vector<Columns>>(columns).reserve(rows), 0)... };
+	}
+
+	void clear() noexcept {
+		resize_all(0);
+	}
+
+	std::size_t size() const noexcept {
+		return std::get<0>(columns).size();
+	}
+
+	bool empty() const noexcept {
+		return size() == 0;
+	}
+
+private:
+	template<class Range>
+	static std::size_t range_length(const Range& values) {
+		using std::begin;
+		using std::end;
+		return static_cast<std::size_t>(std::distance(begin(values), end(values)));
+	}
+
+	template<class C, class Range>
+	void append_column(const Range& values) {
+		auto& c = std::get<std::vector<C>>(columns);
+		using std::begin;
+		using std::end;
+		c.insert(c.end(), begin(values), end(values));
+	}
+
+	template<class C>
+	void truncate(std::size_t rows) noexcept {
+		auto& c = std::get<std::vector<C>>(columns);
+		c.erase(c.begin() + rows, c.end());
+	}
+
+	void resize_all(std::size_t rows) noexcept {
+		(void) detail::expand { 0, (truncate<Columns>(rows), 0)... };
+	}
+
+	bool consistent() const noexcept {
+		const std::size_t sizes[] = { std::get<std::vector<Columns>>(columns).size()... };
+		for (auto s : sizes)
+			if (s != size())
+				return false;
+		return true;
+	}
+
+	std::tuple<std::vector<Columns>...> columns;
+};
+
+#endif /* BUBBLES_SOA_TABLE_HPP_ */
@@ -0,0 +1,130 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Caspar Kielwein
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "soa_table.hpp"
+#include "named_value.hpp"
+#include "benchmark.hpp"
+
+#include <cstdint>
+#include <vector>
+
+/*
+ * Compares scans over a single column and a filtered aggregation over two columns
+ * of a soa_table with the same operations on a std::vector<struct>.
+ *
+ * Tables are built on first use. Add a size to table_sizes to measure larger tables,
+ * 1e8 rows need about 5GB of memory for both layouts.
+ */
+
+namespace {
+
+struct height_tag {};
+struct width_tag {};
+struct id_tag {};
+struct flags_tag {};
+
+using Height = NamedValue<double, height_tag>;
+using Width = NamedValue<double, width_tag>;
+using Id = NamedValue<std::int64_t, id_tag>;
+using Flags = NamedValue<std::int32_t, flags_tag>;
+
+struct record {
+	double height;
+	double width;
+	std::int64_t id;
+	std::int32_t flags;
+};
+
+using table = soa_table<Height, Width, Id, Flags>;
+
+template<std::size_t Rows>
+const std::vector<record>& records() {
+	static const auto r = [] {
+		std::vector<record> r;
+		r.reserve(Rows);
+		for (std::size_t i = 0; i < Rows; ++i) {
+			const auto h = static_cast<double>(i % 1000);
+			r.push_back( { h, 2 * h, static_cast<std::int64_t>(i), static_cast<std::int32_t>(i % 7) });
+		}
+		return r;
+	}();
+	return r;
+}
+
+template<std::size_t Rows>
+const table& columns() {
+	static const auto t = [] {
+		table t;
+		t.reserve(Rows);
+		for (const auto& r : records<Rows>())
+			t.push_back(Height { r.height }, Width { r.width }, Id { r.id }, Flags { r.flags });
+		return t;
+	}();
+	return t;
+}
+
+template<std::size_t Rows>
+bool register_table_benchmarks(const std::string& size) {
+	register_benchmark("scan std::vector<struct>, " + size + " rows", [] {
+		double sum = 0;
+		for (const auto& r : records<Rows>())
+			sum += r.height;
+		do_not_optimize(sum);
+	});
+	register_benchmark("scan soa_table, " + size + " rows", [] {
+		double sum = 0;
+		for (const auto& h : columns<Rows>().template column<Height>())
+			sum += h.get();
+		do_not_optimize(sum);
+	});
+	register_benchmark("filtered sum std::vector<struct>, " + size + " rows", [] {
+		double sum = 0;
+		for (const auto& r : records<Rows>())
+			if (r.flags == 3)
+				sum += r.width;
+		do_not_optimize(sum);
+	});
+	register_benchmark("filtered sum soa_table, " + size + " rows", [] {
+		const auto& t = columns<Rows>();
+		const auto flags = t.template column<Flags>().begin();
+		const auto widths = t.template column<Width>().begin();
+		double sum = 0;
+		for (std::size_t i = 0; i < t.size(); ++i)
+			if (flags[i].get() == 3)
+				sum += widths[i].get();
+		do_not_optimize(sum);
+	});
+	return true;
+}
+
+const bool table_sizes[] = {
+	register_table_benchmarks<1000000>("1e6"),
+	register_table_benchmarks<10000000>("1e7"),
+};
+
+} // namespace
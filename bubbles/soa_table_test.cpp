@@ -0,0 +1,96 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Caspar Kielwein
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "soa_table.hpp"
+#include "named_value.hpp"
+
+#include <cassert>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+struct height_tag {};
+struct width_tag {};
+struct name_tag {};
+
+using Height = NamedValue<double, height_tag>;
+using Width = NamedValue<double, width_tag>;
+using Name = NamedValue<std::string, name_tag>;
+
+int main() {
+	soa_table<Height, Width, Name> table;
+	assert(table.empty());
+
+	table.push_back(Height { 1.0 }, Width { 2.0 }, Name { "first" });
+	table.push_back(Height { 3.0 }, Width { 4.0 }, Name { "second" });
+	assert(table.size() == 2);
+
+	//columns are contiguous
+	auto heights = table.column<Height>();
+	assert(heights.size() == 2);
+	assert(&*heights.begin() + 1 == &heights.begin()[1]);
+	double sum = 0;
+	for (const auto& h : heights)
+		sum += h.get();
+	assert(sum == 4.0);
+
+	//rows give access to all columns
+	auto row = table[1];
+	assert(row.get<Name>() == Name { "second" });
+	row.get<Width>() = Width { 5.0 };
+	assert(table.column<Width>().begin()[1] == Width { 5.0 });
+
+	const auto& const_table = table;
+	assert(const_table[0].get<Height>() == Height { 1.0 });
+
+	std::vector<Height> more_heights { Height { 5.0 }, Height { 6.0 } };
+	std::vector<Width> more_widths { Width { 7.0 }, Width { 8.0 } };
+	std::vector<Name> more_names { Name { "third" }, Name { "fourth" } };
+	table.append(more_heights, more_widths, make_range(more_names.begin(), more_names.end()));
+	assert(table.size() == 4);
+	assert(table[3].get<Name>() == Name { "fourth" });
+	assert(table[2].get<Width>() == Width { 7.0 });
+
+	//ranges of different size are rejected before any column is changed
+	more_widths.pop_back();
+	bool thrown = false;
+	try {
+		table.append(more_heights, more_widths, more_names);
+	} catch (const std::invalid_argument&) {
+		thrown = true;
+	}
+	assert(thrown);
+	assert(table.size() == 4);
+	assert(table.column<Width>().size() == 4);
+
+	table.clear();
+	assert(table.empty());
+	assert(table.column<Name>().size() == 0);
+
+	return 0;
+}
@@ -0,0 +1,260 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Caspar Kielwein
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef BUBBLES_STRING_INTERNER_HPP_
+#define BUBBLES_STRING_INTERNER_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <string_view>
+#include <vector>
+
+namespace detail {
+
+/// interned string as stored in the arena, the characters follow directly
+struct interned_entry {
+	std::size_t hash;
+	std::size_t length;
+
+	const char* data() const noexcept {
+		return reinterpret_cast<const char*>(this + 1);
+	}
+};
+
+} // namespace detail
+
+/**
+ * \brief handle to a string stored in a string_interner.
+ *
+ * Handles of equal strings from the same interner are equal,
+ * comparing and hashing them is O(1).
+ * The handle is a single pointer and stays valid as long as the interner.
+ */
+class interned_string {
+public:
+	/// handle of no string, views the empty string
+	interned_string() noexcept = default;
+
+	std::string_view view() const noexcept {
+		return entry ? std::string_view { entry->data(), entry->length } : std::string_view { };
+	}
+
+	/// hash of the string, computed once on insertion
+	std::size_t hash() const noexcept {
+		return entry ? entry->hash : 0;
+	}
+
+	explicit operator bool() const noexcept {
+		return entry != nullptr;
+	}
+
+	friend bool operator==(interned_string l, interned_string r) noexcept {
+		return l.entry == r.entry;
+	}
+
+	friend bool operator!=(interned_string l, interned_string r) noexcept {
+		return l.entry != r.entry;
+	}
+
+	/// arbitrary but consistent order, e.g. for std::map. Not lexicographic!
+	friend bool operator<(interned_string l, interned_string r) noexcept {
+		return std::less<const detail::interned_entry*> { }(l.entry, r.entry);
+	}
+
+private:
+	friend class string_interner;
+	explicit interned_string(const detail::interned_entry* e) noexcept :
+			entry(e) {
+	}
+
+	const detail::interned_entry* entry = nullptr;
+};
+
+namespace std {
+
+template<>
+struct hash<interned_string> {
+	std::size_t operator()(interned_string s) const noexcept {
+		return s.hash();
+	}
+};
+
+} // namespace std
+
+/**
+ * \brief stores every distinct string once and hands out small handles to it.
+ *
+ * Strings are copied into a growing arena and never move.
+ * Lookups are lock-free, inserting a new string takes a mutex.
+ * Multiple threads can intern concurrently.
+ * ~~~{.cpp}
+ * string_interner names;
+ * auto a = names.intern("requests_total");
+ * auto b = names.intern(std::string { "requests_total" });
+ * assert(a == b);
+ * std::unordered_map<interned_string, int> by_name;
+ * ~~~
+ *
+ * The open addressing table grows by doubling. Readers might still read an old table,
+ * so old tables are only freed together with the interner.
+ * This costs at most as much memory as the current table.
+ *
+ * \author ckielwein
+ */
+class string_interner {
+public:
+	string_interner() {
+		current.store(new_table(64), std::memory_order_relaxed);
+	}
+
+	string_interner(const string_interner&) = delete;
+	string_interner& operator=(const string_interner&) = delete;
+
+	/// returns the handle of \p s, inserts s if it is not interned yet.
+	interned_string intern(std::string_view s) {
+		const auto h = std::hash<std::string_view> { }(s);
+		if (auto* e = find(*current.load(std::memory_order_acquire), s, h))
+			return interned_string { e };
+
+		std::lock_guard<std::mutex> lock { write_mutex };
+		auto* t = current.load(std::memory_order_relaxed);
+		if (auto* e = find(*t, s, h))
+			return interned_string { e };
+
+		if (2 * (count + 1) > t->mask + 1)
+			t = grow();
+		auto* e = allocate(s, h);
+		insert(*t, e);
+		++count;
+		return interned_string { e };
+	}
+
+	/// returns the handle of \p s, or an empty handle if \p s is not interned. Lock-free.
+	interned_string lookup(std::string_view s) const {
+		const auto h = std::hash<std::string_view> { }(s);
+		return interned_string { find(*current.load(std::memory_order_acquire), s, h) };
+	}
+
+	/// number of distinct strings
+	std::size_t size() const {
+		std::lock_guard<std::mutex> lock { write_mutex };
+		return count;
+	}
+
+	/// bytes allocated for strings and hash tables
+	std::size_t memory_usage() const {
+		std::lock_guard<std::mutex> lock { write_mutex };
+		std::size_t bytes = 0;
+		for (const auto& c : chunks)
+			bytes += c.size;
+		for (const auto& t : tables)
+			bytes += sizeof(table) + (t->mask + 1) * sizeof(std::atomic<const entry*>);
+		return bytes;
+	}
+
+private:
+	using entry = detail::interned_entry;
+
+	struct table {
+		std::size_t mask;
+		std::unique_ptr<std::atomic<const entry*>[]> slots;
+	};
+
+	struct chunk {
+		std::unique_ptr<char[]> memory;
+		std::size_t size;
+	};
+
+	static constexpr std::size_t chunk_size = 64 * 1024;
+
+	static const entry* find(const table& t, std::string_view s, std::size_t h) {
+		for (auto i = h & t.mask;; i = (i + 1) & t.mask) {
+			const auto* e = t.slots[i].load(std::memory_order_acquire);
+			if (!e)
+				return nullptr;
+			if (e->hash == h && std::string_view { e->data(), e->length } == s)
+				return e;
+		}
+	}
+
+	static void insert(table& t, const entry* e) {
+		auto i = e->hash & t.mask;
+		while (t.slots[i].load(std::memory_order_relaxed))
+			i = (i + 1) & t.mask;
+		t.slots[i].store(e, std::memory_order_release);
+	}
+
+	table* new_table(std::size_t size) {
+		tables.push_back(std::unique_ptr<table> { new table { size - 1,
+			std::unique_ptr<std::atomic<const entry*>[]> { new std::atomic<const entry*>[size] } } });
+		auto* t = tables.back().get();
+		for (std::size_t i = 0; i < size; ++i)
+			t->slots[i].store(nullptr, std::memory_order_relaxed);
+		return t;
+	}
+
+	table* grow() {
+		const auto* old = current.load(std::memory_order_relaxed);
+		auto* t = new_table(2 * (old->mask + 1));
+		for (std::size_t i = 0; i <= old->mask; ++i)
+			if (const auto* e = old->slots[i].load(std::memory_order_relaxed))
+				insert(*t, e);
+		current.store(t, std::memory_order_release);
+		return t;
+	}
+
+	const entry* allocate(std::string_view s, std::size_t h) {
+		const auto bytes = (sizeof(entry) + s.size() + alignof(entry) - 1) / alignof(entry) * alignof(entry);
+		if (chunks.empty() || used + bytes > chunks.back().size) {
+			const auto size = std::max(chunk_size, bytes);
+			chunks.push_back( { std::unique_ptr<char[]> { new char[size] }, size });
+			used = 0;
+		}
+		auto* memory = chunks.back().memory.get() + used;
+		used += bytes;
+		auto* e = ::new (static_cast<void*>(memory)) entry { h, s.size() };
+		if (!s.empty()) //data() of an empty view may be null
+			std::memcpy(memory + sizeof(entry), s.data(), s.size());
+		return e;
+	}
+
+	std::atomic<table*> current;
+	mutable std::mutex write_mutex;
+	std::vector<std::unique_ptr<table>> tables;
+	std::vector<chunk> chunks;
+	std::size_t used = 0;
+	std::size_t count = 0;
+};
+
+#endif /* BUBBLES_STRING_INTERNER_HPP_ */
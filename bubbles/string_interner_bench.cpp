@@ -0,0 +1,143 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Caspar Kielwein
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "string_interner.hpp"
+#include "benchmark.hpp"
+
+#include <iostream>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/*
+ * Hash map lookups keyed by std::string compared to lookups keyed by interned_string,
+ * on tokens of a synthetic corpus with a zipf distributed vocabulary.
+ * The memory of the 10M token corpus as std::string and as interned_string is reported once on stderr.
+ */
+
+namespace {
+
+constexpr std::size_t vocabulary_size = 50000;
+constexpr std::size_t corpus_tokens = 10000000;
+
+std::vector<std::string> make_vocabulary() {
+	std::mt19937 rng { 42 };
+	std::uniform_int_distribution<int> length { 2, 24 };
+	std::uniform_int_distribution<int> letter { 'a', 'z' };
+	std::vector<std::string> words;
+	for (std::size_t i = 0; i < vocabulary_size; ++i) {
+		std::string w(length(rng), ' ');
+		for (auto& c : w)
+			c = static_cast<char>(letter(rng));
+		words.push_back(w + std::to_string(i));
+	}
+	return words;
+}
+
+/// indices into the vocabulary, word k is drawn with probability proportional to 1/k
+std::vector<std::uint32_t> make_corpus(std::size_t tokens) {
+	std::vector<double> weights;
+	for (std::size_t k = 1; k <= vocabulary_size; ++k)
+		weights.push_back(1.0 / k);
+	std::discrete_distribution<std::uint32_t> zipf { weights.begin(), weights.end() };
+	std::mt19937 rng { 7 };
+	std::vector<std::uint32_t> corpus(tokens);
+	for (auto& t : corpus)
+		t = zipf(rng);
+	return corpus;
+}
+
+struct fixture {
+	fixture() :
+			vocabulary(make_vocabulary()), corpus(make_corpus(corpus_tokens)) {
+		std::size_t string_bytes = corpus.size() * sizeof(std::string);
+		std::vector<interned_string> interned;
+		interned.reserve(corpus.size());
+		for (auto t : corpus) {
+			const auto& w = vocabulary[t];
+			//libstdc++ stores up to 15 characters inline
+			if (w.size() > 15)
+				string_bytes += w.size() + 1;
+			interned.push_back(names.intern(w));
+		}
+		const auto interned_bytes = interned.size() * sizeof(interned_string) + names.memory_usage();
+		std::cerr << corpus.size() << " tokens as std::string: " << string_bytes / (1024 * 1024)
+				<< " MiB, as interned_string: " << interned_bytes / (1024 * 1024) << " MiB\n";
+
+		for (std::size_t i = 0; i < sample_size; ++i) {
+			const auto& w = vocabulary[corpus[i]];
+			strings.push_back(w);
+			handles.push_back(names.lookup(w));
+			by_string[w] += 1;
+			by_handle[handles.back()] += 1;
+		}
+	}
+
+	static constexpr std::size_t sample_size = 1 << 16;
+
+	std::vector<std::string> vocabulary;
+	std::vector<std::uint32_t> corpus;
+	string_interner names;
+	std::vector<std::string> strings;
+	std::vector<interned_string> handles;
+	std::unordered_map<std::string, int> by_string;
+	std::unordered_map<interned_string, int> by_handle;
+};
+
+/// built on first use, so that filtered runs do not pay for the corpus
+fixture& data() {
+	static fixture f;
+	return f;
+}
+
+BENCHMARK("unordered_map<std::string> lookup", [](std::size_t iterations) {
+	auto& f = data();
+	for (std::size_t i = 0; i < iterations; ++i)
+		do_not_optimize(f.by_string.find(f.strings[i % fixture::sample_size]));
+});
+
+BENCHMARK("unordered_map<interned_string> lookup", [](std::size_t iterations) {
+	auto& f = data();
+	for (std::size_t i = 0; i < iterations; ++i)
+		do_not_optimize(f.by_handle.find(f.handles[i % fixture::sample_size]));
+});
+
+BENCHMARK("string_interner::intern existing", [](std::size_t iterations) {
+	auto& f = data();
+	for (std::size_t i = 0; i < iterations; ++i)
+		do_not_optimize(f.names.intern(f.strings[i % fixture::sample_size]));
+});
+
+BENCHMARK("string_interner::intern new", [](std::size_t iterations) {
+	string_interner names;
+	for (std::size_t i = 0; i < iterations; ++i)
+		do_not_optimize(names.intern(std::to_string(i)));
+});
+
+} // namespace
@@ -0,0 +1,94 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Caspar Kielwein
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "string_interner.hpp"
+
+#include <cassert>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+int main() {
+	string_interner names;
+	assert(names.size() == 0);
+	assert(!names.lookup("foo"));
+
+	const auto foo = names.intern("foo");
+	assert(foo);
+	assert(foo.view() == "foo");
+	assert(names.intern(std::string { "foo" }) == foo);
+	assert(names.lookup("foo") == foo);
+	assert(names.intern("bar") != foo);
+	assert(names.size() == 2);
+
+	//empty strings are interned too, the default handle is different
+	const auto empty = names.intern("");
+	assert(empty);
+	assert(empty.view().empty());
+	assert(empty != interned_string { });
+	assert(interned_string { }.view().empty());
+	assert(names.intern(std::string_view { }) == empty);
+
+	//views stay valid while the table grows
+	const auto* data = foo.view().data();
+	for (int i = 0; i < 10000; ++i)
+		names.intern(std::to_string(i));
+	assert(names.size() == 10003);
+	assert(foo.view().data() == data);
+	assert(names.lookup("1234").view() == "1234");
+	assert(names.memory_usage() > 10000 * sizeof(void*));
+
+	//long strings get their own chunk
+	const std::string big(200000, 'x');
+	assert(names.intern(big).view() == big);
+
+	//handles work as keys
+	std::unordered_map<interned_string, int> counts;
+	++counts[names.intern("foo")];
+	++counts[names.lookup("foo")];
+	assert(counts[foo] == 2);
+
+	//concurrent interning of overlapping strings yields one handle per string
+	string_interner shared;
+	std::vector<std::vector<interned_string>> results(4);
+	std::vector<std::thread> threads;
+	for (int t = 0; t < 4; ++t)
+		threads.emplace_back([&, t] {
+			for (int i = 0; i < 5000; ++i)
+				results[t].push_back(shared.intern(std::to_string(i)));
+		});
+	for (auto& t : threads)
+		t.join();
+	assert(shared.size() == 5000);
+	for (int i = 0; i < 5000; ++i) {
+		for (int t = 1; t < 4; ++t)
+			assert(results[t][i] == results[0][i]);
+		assert(results[0][i].view() == std::to_string(i));
+	}
+}
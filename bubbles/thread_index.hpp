@@ -0,0 +1,97 @@
+/*
+ * BSD 2-Clause License
+ *
+ * Copyright (c) 2026, Caspar Kielwein
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ * * Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef BUBBLES_THREAD_INDEX_HPP_
+#define BUBBLES_THREAD_INDEX_HPP_
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace detail {
+
+/// hands out small thread ids, which are reused once a thread exits
+class thread_index_pool {
+public:
+	static thread_index_pool& instance() {
+		static thread_index_pool pool;
+		return pool;
+	}
+
+	std::size_t acquire() {
+		std::lock_guard<std::mutex> lock { mutex };
+		if (free.empty())
+			return next++;
+		const auto index = free.back();
+		free.pop_back();
+		return index;
+	}
+
+	void release(std::size_t index) {
+		std::lock_guard<std::mutex> lock { mutex };
+		free.push_back(index);
+	}
+
+private:
+	std::mutex mutex;
+	std::vector<std::size_t> free;
+	std::size_t next = 0;
+};
+
+/// returns the index of a thread to the pool, when the thread exits
+struct thread_index_holder {
+	thread_index_holder() :
+			index { thread_index_pool::instance().acquire() } {
+	}
+	~thread_index_holder() {
+		thread_index_pool::instance().release(index);
+	}
+
+	static std::size_t current() {
+		thread_local const thread_index_holder holder;
+		return holder.index;
+	}
+
+	const std::size_t index;
+};
+
+} // namespace detail
+
+/**
+ * \brief small index of the calling thread, unique among all running threads
+ *
+ * Indices start at 0 and are reused once a thread exits,
+ * so they stay small and are suitable to index per thread data in arrays.
+ * Releasing and reusing an index synchronizes, a thread reusing an index
+ * sees all writes of the thread which used it before.
+ */
+inline std::size_t thread_index() {
+	return detail::thread_index_holder::current();
+}
+
+#endif /* BUBBLES_THREAD_INDEX_HPP_ */